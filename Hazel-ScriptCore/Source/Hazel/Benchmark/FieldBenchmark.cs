@@ -0,0 +1,35 @@
+namespace Hazel
+{
+	// Instanciated by ScriptEngine::RunFieldBenchmark, twenty public fields of the types scripts usually expose to the editor.
+	internal class FieldBenchmark : Entity
+	{
+		public float Speed = 1.0f;
+		public float JumpHeight = 2.0f;
+		public float Gravity = -9.81f;
+		public float Drag = 0.1f;
+
+		public int Health = 100;
+		public int Armor = 50;
+		public int Lives = 3;
+		public int Score;
+
+		public double SpawnTime = 1.5;
+		public double Cooldown = 0.25;
+
+		public bool IsGrounded = true;
+		public bool IsInvincible;
+
+		public long Seed = 42;
+		public long Ticks;
+
+		public Vector2 Velocity = new Vector2(1.0f, 0.0f);
+		public Vector2 Size = new Vector2(1.0f);
+
+		public Vector3 Offset = new Vector3(0.0f, 1.0f, 0.0f);
+		public Vector3 Target;
+
+		public Vector4 Bounds = new Vector4(-1.0f, -1.0f, 1.0f, 1.0f);
+
+		public Color Tint = new Color(1.0f, 0.5f, 0.25f);
+	}
+}
@@ -0,0 +1,13 @@
+namespace Hazel
+{
+	// Instanciated by ScriptEngine::RunUpdateBenchmark, OnUpdate does close to nothing so only the call itself is measured.
+	internal class UpdateBenchmark : Entity
+	{
+		private float _elapsed;
+
+		private void OnUpdate(float timestep)
+		{
+			_elapsed += timestep;
+		}
+	}
+}
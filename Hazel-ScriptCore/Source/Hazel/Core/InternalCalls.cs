@@ -58,28 +58,28 @@ namespace Hazel
 		//////////////
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool Entity_IsValid(ulong entityId);
+		internal static extern bool Entity_IsValid(ulong entityId, uint entityHandle);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern void Entity_Create(string name, out Entity entity);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool Entity_Destroy(ulong entityId);
+		internal static extern bool Entity_Destroy(ulong entityId, uint entityHandle);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
 		internal static extern bool Entity_FindByName(string name, out Entity entity);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Entity_AddComponent(ulong entityId, Type type);
+		internal static extern void Entity_AddComponent(ulong entityId, uint entityHandle, Type type);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern bool Entity_HasComponent(ulong entityId, Type componentType);
+		internal static extern bool Entity_HasComponent(ulong entityId, uint entityHandle, Type componentType);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Entity_GetName(ulong entityId, out string name);
+		internal static extern void Entity_GetName(ulong entityId, uint entityHandle, out string name);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Entity_SetName(ulong entityId, string name);
+		internal static extern void Entity_SetName(ulong entityId, uint entityHandle, string name);
 
 		//////////////
 		// Components
@@ -88,158 +88,188 @@ namespace Hazel
 		#region Transform
 		/* Transform */
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetPosition(ulong entityId, out Vector3 position);
+		internal static extern void TransformComponent_GetPosition(ulong entityId, uint entityHandle, out Vector3 position);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetPosition(ulong entityId, ref Vector3 position);
+		internal static extern void TransformComponent_SetPosition(ulong entityId, uint entityHandle, ref Vector3 position);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetRotation(ulong entityId, out Vector3 rotation);
+		internal static extern void TransformComponent_GetRotation(ulong entityId, uint entityHandle, out Vector3 rotation);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetRotation(ulong entityId, ref Vector3 rotation);
+		internal static extern void TransformComponent_SetRotation(ulong entityId, uint entityHandle, ref Vector3 rotation);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_GetScale(ulong entityId, out Vector3 scale);
+		internal static extern void TransformComponent_GetScale(ulong entityId, uint entityHandle, out Vector3 scale);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void TransformComponent_SetScale(ulong entityId, ref Vector3 scale);
+		internal static extern void TransformComponent_SetScale(ulong entityId, uint entityHandle, ref Vector3 scale);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int TransformComponent_GetPositions(ulong[] entityIds, uint[] entityHandles, int count, Vector3[] values);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int TransformComponent_SetPositions(ulong[] entityIds, uint[] entityHandles, int count, Vector3[] values);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int TransformComponent_GetRotations(ulong[] entityIds, uint[] entityHandles, int count, Vector3[] values);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int TransformComponent_SetRotations(ulong[] entityIds, uint[] entityHandles, int count, Vector3[] values);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int TransformComponent_GetScales(ulong[] entityIds, uint[] entityHandles, int count, Vector3[] values);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern int TransformComponent_SetScales(ulong[] entityIds, uint[] entityHandles, int count, Vector3[] values);
 		#endregion
 
 		#region Camera
 		/* Camera */
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CameraComponent_GetIsPrimary(ulong entityId, out bool isPrimary);
+		internal static extern void CameraComponent_GetIsPrimary(ulong entityId, uint entityHandle, out bool isPrimary);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CameraComponent_SetIsPrimary(ulong entityId, ref bool isPrimary);
+		internal static extern void CameraComponent_SetIsPrimary(ulong entityId, uint entityHandle, ref bool isPrimary);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CameraComponent_GetIsFixedAspectRatio(ulong entityId, out bool isFixedAspectRatio);
+		internal static extern void CameraComponent_GetIsFixedAspectRatio(ulong entityId, uint entityHandle, out bool isFixedAspectRatio);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CameraComponent_SetIsFixedAspectRatio(ulong entityId, ref bool isFixedAspectRatio);
+		internal static extern void CameraComponent_SetIsFixedAspectRatio(ulong entityId, uint entityHandle, ref bool isFixedAspectRatio);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CameraComponent_GetOrthographicSize(ulong entityId, out float size);
+		internal static extern void CameraComponent_GetOrthographicSize(ulong entityId, uint entityHandle, out float size);
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CameraComponent_SetOrthographicSize(ulong entityId, ref float size);
+		internal static extern void CameraComponent_SetOrthographicSize(ulong entityId, uint entityHandle, ref float size);
 		#endregion
 
 		#region Sprite Renderer
 		/* Sprite Renderer */
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_GetTiling(ulong entityId, out Vector2 tiling);
+		internal static extern void SpriteRendererComponent_GetTiling(ulong entityId, uint entityHandle, out Vector2 tiling);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void SpriteRendererComponent_SetTiling(ulong entityId, uint entityHandle, ref Vector2 tiling);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void SpriteRendererComponent_GetColor(ulong entityId, uint entityHandle, out Color color);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_SetTiling(ulong entityId, ref Vector2 tiling);
+		internal static extern void SpriteRendererComponent_SetColor(ulong entityId, uint entityHandle, ref Color color);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_GetColor(ulong entityId, out Color color);
+		internal static extern int SpriteRendererComponent_GetColors(ulong[] entityIds, uint[] entityHandles, int count, Color[] values);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void SpriteRendererComponent_SetColor(ulong entityId, ref Color color);
+		internal static extern int SpriteRendererComponent_SetColors(ulong[] entityIds, uint[] entityHandles, int count, Color[] values);
 		#endregion
 
 		#region Circle Renderer
 		/* Circle Renderer*/
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CircleRendererComponent_GetColor(ulong entityId, out Color color);
+		internal static extern void CircleRendererComponent_GetColor(ulong entityId, uint entityHandle, out Color color);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CircleRendererComponent_SetColor(ulong entityId, ref Color color);
+		internal static extern void CircleRendererComponent_SetColor(ulong entityId, uint entityHandle, ref Color color);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CircleRendererComponent_GetThickness(ulong entityId, out float thickness);
+		internal static extern void CircleRendererComponent_GetThickness(ulong entityId, uint entityHandle, out float thickness);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CircleRendererComponent_SetThickness(ulong entityId, ref float thickness);
+		internal static extern void CircleRendererComponent_SetThickness(ulong entityId, uint entityHandle, ref float thickness);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CircleRendererComponent_GetFade(ulong entityId, out float fade);
+		internal static extern void CircleRendererComponent_GetFade(ulong entityId, uint entityHandle, out float fade);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void CircleRendererComponent_SetFade(ulong entityId, ref float fade);
+		internal static extern void CircleRendererComponent_SetFade(ulong entityId, uint entityHandle, ref float fade);
 		#endregion
 
 		#region Rigibody 2D
 		/* Rigibody 2D */
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_GetLinearVelocity(ulong entityId, out Vector2 linearVelocity);
+		internal static extern void Rigidbody2DComponent_GetLinearVelocity(ulong entityId, uint entityHandle, out Vector2 linearVelocity);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Rigidbody2DComponent_ApplyLinearImpulse(ulong entityId, uint entityHandle, ref Vector2 impulse, ref Vector2 point, bool wake);
+
+		[MethodImpl(MethodImplOptions.InternalCall)]
+		internal static extern void Rigidbody2DComponent_ApplyLinearImpulseToCenter(ulong entityId, uint entityHandle, ref Vector2 impulse, bool wake);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyLinearImpulse(ulong entityId, ref Vector2 impulse, ref Vector2 point, bool wake);
+		internal static extern void Rigidbody2DComponent_ApplyAngularImpulse(ulong entityId, uint entityHandle, float impulse, bool wake);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyLinearImpulseToCenter(ulong entityId, ref Vector2 impulse, bool wake);
+		internal static extern int Rigidbody2DComponent_GetLinearVelocities(ulong[] entityIds, uint[] entityHandles, int count, Vector2[] values);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void Rigidbody2DComponent_ApplyAngularImpulse(ulong entityId, float impulse, bool wake);
+		internal static extern int Rigidbody2DComponent_SetLinearVelocities(ulong[] entityIds, uint[] entityHandles, int count, Vector2[] values);
 		#endregion
 
 		#region Audio Listener
 		/* Audio Listener */
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioListenerComponent_GetIsVisibleInGame(ulong entityId, out bool isVisibleInGame);
+		internal static extern void AudioListenerComponent_GetIsVisibleInGame(ulong entityId, uint entityHandle, out bool isVisibleInGame);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioListenerComponent_SetIsVisibleInGame(ulong entityId, bool isVisibleInGame);
+		internal static extern void AudioListenerComponent_SetIsVisibleInGame(ulong entityId, uint entityHandle, bool isVisibleInGame);
 		#endregion
 
 		#region Audio Source
 		/* Audio Source */
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetGain(UUID id, out float gain);
+		internal static extern void AudioSourceComponent_GetGain(UUID id, uint entityHandle, out float gain);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_SetGain(UUID id, float gain);
+		internal static extern void AudioSourceComponent_SetGain(UUID id, uint entityHandle, float gain);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetPitch(UUID id, out float pitch);
+		internal static extern void AudioSourceComponent_GetPitch(UUID id, uint entityHandle, out float pitch);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_SetPitch(UUID id, float pitch);
+		internal static extern void AudioSourceComponent_SetPitch(UUID id, uint entityHandle, float pitch);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetLoop(UUID id, out bool isLoop);
+		internal static extern void AudioSourceComponent_GetLoop(UUID id, uint entityHandle, out bool isLoop);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_SetLoop(UUID id, bool isLoop);
+		internal static extern void AudioSourceComponent_SetLoop(UUID id, uint entityHandle, bool isLoop);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_Get3D(UUID id, out bool is3D);
+		internal static extern void AudioSourceComponent_Get3D(UUID id, uint entityHandle, out bool is3D);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_Set3D(UUID id, bool is3D);
+		internal static extern void AudioSourceComponent_Set3D(UUID id, uint entityHandle, bool is3D);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetState(UUID id, out int state);
+		internal static extern void AudioSourceComponent_GetState(UUID id, uint entityHandle, out int state);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetOffset(UUID id, out float offset);
+		internal static extern void AudioSourceComponent_GetOffset(UUID id, uint entityHandle, out float offset);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_SetOffset(UUID id, float offset);
+		internal static extern void AudioSourceComponent_SetOffset(UUID id, uint entityHandle, float offset);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetLength(UUID id, out float lenght);
+		internal static extern void AudioSourceComponent_GetLength(UUID id, uint entityHandle, out float lenght);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetPath(UUID id, out string path);
+		internal static extern void AudioSourceComponent_GetPath(UUID id, uint entityHandle, out string path);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_Play(UUID id);
+		internal static extern void AudioSourceComponent_Play(UUID id, uint entityHandle);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_Stop(UUID id);
+		internal static extern void AudioSourceComponent_Stop(UUID id, uint entityHandle);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_Pause(UUID id);
+		internal static extern void AudioSourceComponent_Pause(UUID id, uint entityHandle);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_Rewind(UUID id);
+		internal static extern void AudioSourceComponent_Rewind(UUID id, uint entityHandle);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_GetIsVisibleInGame(UUID id, out bool isVisibleInGame);
+		internal static extern void AudioSourceComponent_GetIsVisibleInGame(UUID id, uint entityHandle, out bool isVisibleInGame);
 
 		[MethodImpl(MethodImplOptions.InternalCall)]
-		internal static extern void AudioSourceComponent_SetIsVisibleInGame(UUID id, bool isVisibleInGame);
+		internal static extern void AudioSourceComponent_SetIsVisibleInGame(UUID id, uint entityHandle, bool isVisibleInGame);
 		#endregion
 	}
 }
@@ -61,33 +61,33 @@
 		{
 			get
 			{
-				InternalCalls.TransformComponent_GetPosition(Entity.Id, out var position);
+				InternalCalls.TransformComponent_GetPosition(Entity.Id, Entity.Handle, out var position);
 				return position;
 			}
 
-			set => InternalCalls.TransformComponent_SetPosition(Entity.Id, ref value);
+			set => InternalCalls.TransformComponent_SetPosition(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public Vector3 Rotation
 		{
 			get
 			{
-				InternalCalls.TransformComponent_GetRotation(Entity.Id, out var rotation);
+				InternalCalls.TransformComponent_GetRotation(Entity.Id, Entity.Handle, out var rotation);
 				return rotation;
 			}
 
-			set => InternalCalls.TransformComponent_SetRotation(Entity.Id, ref value);
+			set => InternalCalls.TransformComponent_SetRotation(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public Vector3 Scale
 		{
 			get
 			{
-				InternalCalls.TransformComponent_GetScale(Entity.Id, out var scale);
+				InternalCalls.TransformComponent_GetScale(Entity.Id, Entity.Handle, out var scale);
 				return scale;
 			}
 
-			set => InternalCalls.TransformComponent_SetScale(Entity.Id, ref value);
+			set => InternalCalls.TransformComponent_SetScale(Entity.Id, Entity.Handle, ref value);
 		}
 	}
 
@@ -97,33 +97,33 @@
 		{
 			get
 			{
-				InternalCalls.CameraComponent_GetIsPrimary(Entity.Id, out var isPrimary);
+				InternalCalls.CameraComponent_GetIsPrimary(Entity.Id, Entity.Handle, out var isPrimary);
 				return isPrimary;
 			}
 
-			set => InternalCalls.CameraComponent_SetIsPrimary(Entity.Id, ref value);
+			set => InternalCalls.CameraComponent_SetIsPrimary(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public bool IsFixedAspectRatio
 		{
 			get
 			{
-				InternalCalls.CameraComponent_GetIsFixedAspectRatio(Entity.Id, out var isFixedAspectRatio);
+				InternalCalls.CameraComponent_GetIsFixedAspectRatio(Entity.Id, Entity.Handle, out var isFixedAspectRatio);
 				return isFixedAspectRatio;
 			}
 
-			set => InternalCalls.CameraComponent_SetIsFixedAspectRatio(Entity.Id, ref value);
+			set => InternalCalls.CameraComponent_SetIsFixedAspectRatio(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public float GetOrthographicSize()
 		{
-			InternalCalls.CameraComponent_GetOrthographicSize(Entity.Id, out var size);
+			InternalCalls.CameraComponent_GetOrthographicSize(Entity.Id, Entity.Handle, out var size);
 			return size;
 		}
 
 		public void SetOrthographicSize(float value)
 		{
-			InternalCalls.CameraComponent_SetOrthographicSize(Entity.Id, ref value);
+			InternalCalls.CameraComponent_SetOrthographicSize(Entity.Id, Entity.Handle, ref value);
 		}
 	}
 
@@ -133,22 +133,22 @@
 		{
 			get
 			{
-				InternalCalls.SpriteRendererComponent_GetColor(Entity.Id, out var color);
+				InternalCalls.SpriteRendererComponent_GetColor(Entity.Id, Entity.Handle, out var color);
 				return color;
 			}
 
-			set => InternalCalls.SpriteRendererComponent_SetColor(Entity.Id, ref value);
+			set => InternalCalls.SpriteRendererComponent_SetColor(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public Vector2 Tiling
 		{
 			get
 			{
-				InternalCalls.SpriteRendererComponent_GetTiling(Entity.Id, out var tiling);
+				InternalCalls.SpriteRendererComponent_GetTiling(Entity.Id, Entity.Handle, out var tiling);
 				return tiling;
 			}
 
-			set => InternalCalls.SpriteRendererComponent_SetTiling(Entity.Id, ref value);
+			set => InternalCalls.SpriteRendererComponent_SetTiling(Entity.Id, Entity.Handle, ref value);
 		}
 	}
 
@@ -158,33 +158,33 @@
 		{
 			get
 			{
-				InternalCalls.CircleRendererComponent_GetColor(Entity.Id, out var color);
+				InternalCalls.CircleRendererComponent_GetColor(Entity.Id, Entity.Handle, out var color);
 				return color;
 			}
 
-			set => InternalCalls.CircleRendererComponent_SetColor(Entity.Id, ref value);
+			set => InternalCalls.CircleRendererComponent_SetColor(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public float Thickness
 		{
 			get
 			{
-				InternalCalls.CircleRendererComponent_GetThickness(Entity.Id, out var thickness);
+				InternalCalls.CircleRendererComponent_GetThickness(Entity.Id, Entity.Handle, out var thickness);
 				return thickness;
 			}
 
-			set => InternalCalls.CircleRendererComponent_SetThickness(Entity.Id, ref value);
+			set => InternalCalls.CircleRendererComponent_SetThickness(Entity.Id, Entity.Handle, ref value);
 		}
 
 		public float Fade
 		{
 			get
 			{
-				InternalCalls.CircleRendererComponent_GetFade(Entity.Id, out var fade);
+				InternalCalls.CircleRendererComponent_GetFade(Entity.Id, Entity.Handle, out var fade);
 				return fade;
 			}
 
-			set => InternalCalls.CircleRendererComponent_SetFade(Entity.Id, ref value);
+			set => InternalCalls.CircleRendererComponent_SetFade(Entity.Id, Entity.Handle, ref value);
 		}
 	}
 
@@ -194,24 +194,24 @@
 		{
 			get
 			{
-				InternalCalls.Rigidbody2DComponent_GetLinearVelocity(Entity.Id, out var linearVelocity);
+				InternalCalls.Rigidbody2DComponent_GetLinearVelocity(Entity.Id, Entity.Handle, out var linearVelocity);
 				return linearVelocity;
 			}
 		}
 
 		public void ApplyLinearImpulse(Vector2 impulse, Vector2 worldPoint, bool wake = true)
 		{
-			InternalCalls.Rigidbody2DComponent_ApplyLinearImpulse(Entity.Id, ref impulse, ref worldPoint, wake);
+			InternalCalls.Rigidbody2DComponent_ApplyLinearImpulse(Entity.Id, Entity.Handle, ref impulse, ref worldPoint, wake);
 		}
 
 		public void ApplyLinearImpulse(Vector2 impulse, bool wake = true)
 		{
-			InternalCalls.Rigidbody2DComponent_ApplyLinearImpulseToCenter(Entity.Id, ref impulse, wake);
+			InternalCalls.Rigidbody2DComponent_ApplyLinearImpulseToCenter(Entity.Id, Entity.Handle, ref impulse, wake);
 		}
 
 		public void ApplyAngularImpulse(float impulse, bool wake = true)
 		{
-			InternalCalls.Rigidbody2DComponent_ApplyAngularImpulse(Entity.Id, impulse, wake);
+			InternalCalls.Rigidbody2DComponent_ApplyAngularImpulse(Entity.Id, Entity.Handle, impulse, wake);
 		}
 	}
 
@@ -221,11 +221,11 @@
 		{
 			get
 			{
-				InternalCalls.AudioListenerComponent_GetIsVisibleInGame(Entity.Id, out var isVisibleInGame);
+				InternalCalls.AudioListenerComponent_GetIsVisibleInGame(Entity.Id, Entity.Handle, out var isVisibleInGame);
 				return isVisibleInGame;
 			}
 
-			set => InternalCalls.AudioListenerComponent_SetIsVisibleInGame(Entity.Id, value);
+			set => InternalCalls.AudioListenerComponent_SetIsVisibleInGame(Entity.Id, Entity.Handle, value);
 		}
 	}
 
@@ -244,47 +244,47 @@
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetGain(Entity.Id, out var gain);
+				InternalCalls.AudioSourceComponent_GetGain(Entity.Id, Entity.Handle, out var gain);
 				return gain;
 			}
-			set => InternalCalls.AudioSourceComponent_SetGain(Entity.Id, value);
+			set => InternalCalls.AudioSourceComponent_SetGain(Entity.Id, Entity.Handle, value);
 		}
 
 		public float Pitch
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetPitch(Entity.Id, out var pitch);
+				InternalCalls.AudioSourceComponent_GetPitch(Entity.Id, Entity.Handle, out var pitch);
 				return pitch;
 			}
-			set => InternalCalls.AudioSourceComponent_SetPitch(Entity.Id, value);
+			set => InternalCalls.AudioSourceComponent_SetPitch(Entity.Id, Entity.Handle, value);
 		}
 
 		public bool IsLoop
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetLoop(Entity.Id, out var isLoop);
+				InternalCalls.AudioSourceComponent_GetLoop(Entity.Id, Entity.Handle, out var isLoop);
 				return isLoop;
 			}
-			set => InternalCalls.AudioSourceComponent_SetLoop(Entity.Id, value);
+			set => InternalCalls.AudioSourceComponent_SetLoop(Entity.Id, Entity.Handle, value);
 		}
 
 		public bool Is3D
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_Get3D(Entity.Id, out var is3D);
+				InternalCalls.AudioSourceComponent_Get3D(Entity.Id, Entity.Handle, out var is3D);
 				return is3D;
 			}
-			set => InternalCalls.AudioSourceComponent_Set3D(Entity.Id, value);
+			set => InternalCalls.AudioSourceComponent_Set3D(Entity.Id, Entity.Handle, value);
 		}
 
 		public AudioSourceState State
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetState(Entity.Id, out var state);
+				InternalCalls.AudioSourceComponent_GetState(Entity.Id, Entity.Handle, out var state);
 				return (AudioSourceState)state;
 			}
 		}
@@ -293,17 +293,17 @@
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetOffset(Entity.Id, out var offset);
+				InternalCalls.AudioSourceComponent_GetOffset(Entity.Id, Entity.Handle, out var offset);
 				return offset;
 			}
-			set => InternalCalls.AudioSourceComponent_SetOffset(Entity.Id, value);
+			set => InternalCalls.AudioSourceComponent_SetOffset(Entity.Id, Entity.Handle, value);
 		}
 
 		public float Length
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetLength(Entity.Id, out var lenght);
+				InternalCalls.AudioSourceComponent_GetLength(Entity.Id, Entity.Handle, out var lenght);
 				return lenght;
 			}
 		}
@@ -312,7 +312,7 @@
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetPath(Entity.Id, out var path);
+				InternalCalls.AudioSourceComponent_GetPath(Entity.Id, Entity.Handle, out var path);
 				return path;
 			}
 		}
@@ -321,17 +321,17 @@
 		{
 			get
 			{
-				InternalCalls.AudioSourceComponent_GetIsVisibleInGame(Entity.Id, out var isVisibleInGame);
+				InternalCalls.AudioSourceComponent_GetIsVisibleInGame(Entity.Id, Entity.Handle, out var isVisibleInGame);
 				return isVisibleInGame;
 			}
 
-			set => InternalCalls.AudioSourceComponent_SetIsVisibleInGame(Entity.Id, value);
+			set => InternalCalls.AudioSourceComponent_SetIsVisibleInGame(Entity.Id, Entity.Handle, value);
 		}
 
 
-		public void Play() => InternalCalls.AudioSourceComponent_Play(Entity.Id);
-		public void Stop() => InternalCalls.AudioSourceComponent_Stop(Entity.Id);
-		public void Pause() => InternalCalls.AudioSourceComponent_Pause(Entity.Id);
-		public void Rewind() => InternalCalls.AudioSourceComponent_Rewind(Entity.Id);
+		public void Play() => InternalCalls.AudioSourceComponent_Play(Entity.Id, Entity.Handle);
+		public void Stop() => InternalCalls.AudioSourceComponent_Stop(Entity.Id, Entity.Handle);
+		public void Pause() => InternalCalls.AudioSourceComponent_Pause(Entity.Id, Entity.Handle);
+		public void Rewind() => InternalCalls.AudioSourceComponent_Rewind(Entity.Id, Entity.Handle);
 	}
 }
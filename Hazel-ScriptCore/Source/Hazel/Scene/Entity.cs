@@ -7,15 +7,22 @@ namespace Hazel
 	{
 		public readonly UUID Id;
 
+		/// <summary>
+		/// Entity handle in the running scene, internal calls index the registry with it instead of looking up the Id.
+		/// </summary>
+		internal readonly uint Handle;
+
+		private const uint kNullHandle = uint.MaxValue;
+
 		public string Name
 		{
 			get
 			{
-				InternalCalls.Entity_GetName(Id, out var name);
+				InternalCalls.Entity_GetName(Id, Handle, out var name);
 				return name;
 			}
 
-			set => InternalCalls.Entity_SetName(Id, value);
+			set => InternalCalls.Entity_SetName(Id, Handle, value);
 		}
 
 		private TransformComponent _transform;
@@ -36,11 +43,13 @@ namespace Hazel
 		protected Entity()
 		{
 			Id = new UUID(0);
+			Handle = kNullHandle;
 		}
 
-		internal Entity(ulong id)
+		internal Entity(ulong id, uint handle)
 		{
 			Id = new UUID(id);
+			Handle = handle;
 		}
 
 		public override string ToString()
@@ -64,12 +73,12 @@ namespace Hazel
 			{
 				throw new ArgumentException($"Invalid type! {componentType} is not a subtype of {typeof(Component)}");
 			}
-			return InternalCalls.Entity_HasComponent(Id, componentType);
+			return InternalCalls.Entity_HasComponent(Id, Handle, componentType);
 		}
 
 		public bool HasComponent<T>() where T : Component, new()
 		{
-			return InternalCalls.Entity_HasComponent(Id, typeof(T));
+			return InternalCalls.Entity_HasComponent(Id, Handle, typeof(T));
 		}
 
 		public Component GetComponent(Type componentType)
@@ -97,7 +106,7 @@ namespace Hazel
 				return null;
 			}
 
-			InternalCalls.Entity_AddComponent(Id, typeof(T));
+			InternalCalls.Entity_AddComponent(Id, Handle, typeof(T));
 
 			return new T { Entity = this };
 		}
@@ -109,7 +118,7 @@ namespace Hazel
 
 		public bool Destroy()
 		{
-			return InternalCalls.Entity_Destroy(Id);
+			return InternalCalls.Entity_Destroy(Id, Handle);
 		}
 
 		public bool IsValid()
@@ -126,7 +135,7 @@ namespace Hazel
 
 		public static bool Destroy(Entity entity)
 		{
-			return !entity || InternalCalls.Entity_Destroy(entity.Id);
+			return !entity || InternalCalls.Entity_Destroy(entity.Id, entity.Handle);
 		}
 
 		/// <summary>
@@ -177,7 +186,7 @@ namespace Hazel
 
 		private static bool IsValid(Entity entity)
 		{
-			return InternalCalls.Entity_IsValid(entity.Id);
+			return InternalCalls.Entity_IsValid(entity.Id, entity.Handle);
 		}
 	}
 }
@@ -0,0 +1,164 @@
+using System;
+using System.Collections.Generic;
+
+namespace Hazel
+{
+	/// <summary>
+	/// Entities whose components are read and written in bulk, a single internal call for the whole group instead of one per entity.
+	/// Value arrays are indexed like the group. Entities destroyed since they were added, missing the component, or without
+	/// a physics body for velocities, are skipped and their values left untouched, each call returning the number of entities processed.
+	/// </summary>
+	public class EntityGroup
+	{
+		private const int kInitialCapacity = 16;
+
+		private readonly Dictionary<UUID, int> _indices = new Dictionary<UUID, int>();
+		private ulong[] _ids = new ulong[kInitialCapacity];
+		private uint[] _handles = new uint[kInitialCapacity];
+		private int _count;
+
+		public int Count => _count;
+
+		public EntityGroup() { }
+
+		public EntityGroup(IEnumerable<Entity> entities)
+		{
+			foreach (var entity in entities)
+			{
+				Add(entity);
+			}
+		}
+
+		/// <summary>
+		/// False when the entity is null or already in the group.
+		/// </summary>
+		public bool Add(Entity entity)
+		{
+			if (entity is null || _indices.ContainsKey(entity.Id))
+			{
+				return false;
+			}
+
+			if (_count == _ids.Length)
+			{
+				Array.Resize(ref _ids, _count * 2);
+				Array.Resize(ref _handles, _count * 2);
+			}
+
+			_indices.Add(entity.Id, _count);
+			_ids[_count] = entity.Id;
+			_handles[_count] = entity.Handle;
+			_count++;
+			return true;
+		}
+
+		/// <summary>
+		/// The last entity takes the index of the removed one.
+		/// </summary>
+		public bool Remove(Entity entity)
+		{
+			if (entity is null || !_indices.TryGetValue(entity.Id, out var index))
+			{
+				return false;
+			}
+
+			_indices.Remove(entity.Id);
+			_count--;
+			if (index != _count)
+			{
+				_ids[index] = _ids[_count];
+				_handles[index] = _handles[_count];
+				_indices[new UUID(_ids[index])] = index;
+			}
+
+			return true;
+		}
+
+		public void Clear()
+		{
+			_indices.Clear();
+			_count = 0;
+		}
+
+		/// <summary>
+		/// -1 when the entity is not in the group.
+		/// </summary>
+		public int IndexOf(Entity entity)
+		{
+			return !(entity is null) && _indices.TryGetValue(entity.Id, out var index) ? index : -1;
+		}
+
+		public int GetPositions(Vector3[] positions)
+		{
+			CheckLength(positions);
+			return InternalCalls.TransformComponent_GetPositions(_ids, _handles, _count, positions);
+		}
+
+		public int SetPositions(Vector3[] positions)
+		{
+			CheckLength(positions);
+			return InternalCalls.TransformComponent_SetPositions(_ids, _handles, _count, positions);
+		}
+
+		public int GetRotations(Vector3[] rotations)
+		{
+			CheckLength(rotations);
+			return InternalCalls.TransformComponent_GetRotations(_ids, _handles, _count, rotations);
+		}
+
+		public int SetRotations(Vector3[] rotations)
+		{
+			CheckLength(rotations);
+			return InternalCalls.TransformComponent_SetRotations(_ids, _handles, _count, rotations);
+		}
+
+		public int GetScales(Vector3[] scales)
+		{
+			CheckLength(scales);
+			return InternalCalls.TransformComponent_GetScales(_ids, _handles, _count, scales);
+		}
+
+		public int SetScales(Vector3[] scales)
+		{
+			CheckLength(scales);
+			return InternalCalls.TransformComponent_SetScales(_ids, _handles, _count, scales);
+		}
+
+		public int GetSpriteColors(Color[] colors)
+		{
+			CheckLength(colors);
+			return InternalCalls.SpriteRendererComponent_GetColors(_ids, _handles, _count, colors);
+		}
+
+		public int SetSpriteColors(Color[] colors)
+		{
+			CheckLength(colors);
+			return InternalCalls.SpriteRendererComponent_SetColors(_ids, _handles, _count, colors);
+		}
+
+		public int GetLinearVelocities(Vector2[] linearVelocities)
+		{
+			CheckLength(linearVelocities);
+			return InternalCalls.Rigidbody2DComponent_GetLinearVelocities(_ids, _handles, _count, linearVelocities);
+		}
+
+		public int SetLinearVelocities(Vector2[] linearVelocities)
+		{
+			CheckLength(linearVelocities);
+			return InternalCalls.Rigidbody2DComponent_SetLinearVelocities(_ids, _handles, _count, linearVelocities);
+		}
+
+		private void CheckLength(Array values)
+		{
+			if (values is null)
+			{
+				throw new ArgumentNullException(nameof(values));
+			}
+
+			if (values.Length < _count)
+			{
+				throw new ArgumentException($"Invalid length! {values.Length} values for {_count} entities");
+			}
+		}
+	}
+}
@@ -0,0 +1,168 @@
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+
+namespace Hazel
+{
+	/// <summary>
+	/// Calls OnUpdate on every registered script from managed code, the engine makes one call per frame instead of one per entity.
+	/// Instances are registered by the engine when created and grouped by class, each class calling OnUpdate through a typed delegate.
+	/// </summary>
+	internal static class ScriptUpdateDispatcher
+	{
+		private static readonly Dictionary<Type, ScriptUpdateBatch> _sBatchesByType = new Dictionary<Type, ScriptUpdateBatch>();
+		private static readonly List<ScriptUpdateBatch> _sBatches = new List<ScriptUpdateBatch>();
+
+		internal static void Register(Entity instance)
+		{
+			var type = instance.GetType();
+			if (!_sBatchesByType.TryGetValue(type, out var batch))
+			{
+				batch = ScriptUpdateBatch.Create(type);
+				_sBatchesByType.Add(type, batch);
+				if (batch != null)
+				{
+					_sBatches.Add(batch);
+				}
+			}
+
+			batch?.Add(instance);
+		}
+
+		internal static void Unregister(Entity instance)
+		{
+			if (_sBatchesByType.TryGetValue(instance.GetType(), out var batch))
+			{
+				batch?.Remove(instance);
+			}
+		}
+
+		internal static void Clear()
+		{
+			_sBatchesByType.Clear();
+			_sBatches.Clear();
+		}
+
+		internal static void Update(float timestep)
+		{
+			// Indexed, scripts may register new classes while updating.
+			for (var i = 0; i < _sBatches.Count; i++)
+			{
+				_sBatches[i].Update(timestep);
+			}
+		}
+	}
+
+	internal abstract class ScriptUpdateBatch
+	{
+		private const BindingFlags kOnUpdateFlags = BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic;
+
+		internal abstract void Add(Entity instance);
+		internal abstract void Remove(Entity instance);
+		internal abstract void Update(float timestep);
+
+		/// <summary>
+		/// Null when the type has no OnUpdate(float).
+		/// </summary>
+		internal static ScriptUpdateBatch Create(Type type)
+		{
+			var onUpdate = type.GetMethod("OnUpdate", kOnUpdateFlags, null, new[] { typeof(float) }, null);
+			if (onUpdate == null || onUpdate.ReturnType != typeof(void))
+			{
+				return null;
+			}
+
+			var batchType = typeof(ScriptUpdateBatch<>).MakeGenericType(type);
+			return (ScriptUpdateBatch)Activator.CreateInstance(batchType, onUpdate);
+		}
+	}
+
+	internal sealed class ScriptUpdateBatch<T> : ScriptUpdateBatch where T : Entity
+	{
+		private readonly Action<T, float> _onUpdate;
+		private readonly Dictionary<UUID, int> _indices = new Dictionary<UUID, int>();
+		private T[] _instances = new T[64];
+		private int _count;
+		private bool _hasHoles;
+
+		public ScriptUpdateBatch(MethodInfo onUpdate)
+		{
+			// Open instance delegate, called like a static method taking the instance first.
+			_onUpdate = (Action<T, float>)Delegate.CreateDelegate(typeof(Action<T, float>), onUpdate);
+		}
+
+		internal override void Add(Entity instance)
+		{
+			if (_count == _instances.Length)
+			{
+				Array.Resize(ref _instances, _count * 2);
+			}
+
+			_indices[instance.Id] = _count;
+			_instances[_count++] = (T)instance;
+		}
+
+		internal override void Remove(Entity instance)
+		{
+			if (!_indices.TryGetValue(instance.Id, out var index))
+			{
+				return;
+			}
+
+			// Left as a hole until the next update, an update in progress keeps its indices.
+			_indices.Remove(instance.Id);
+			_instances[index] = null;
+			_hasHoles = true;
+		}
+
+		internal override void Update(float timestep)
+		{
+			if (_hasHoles)
+			{
+				Compact();
+			}
+
+			// A throwing script is logged and skipped, the others are still updated.
+			var i = 0;
+			while (i < _count)
+			{
+				try
+				{
+					for (; i < _count; i++)
+					{
+						var instance = _instances[i];
+						if (instance != null)
+						{
+							_onUpdate(instance, timestep);
+						}
+					}
+				}
+				catch (Exception exception)
+				{
+					Logger.Error($"{typeof(T).FullName}.OnUpdate - {exception}");
+					i++;
+				}
+			}
+		}
+
+		private void Compact()
+		{
+			var count = 0;
+			for (var i = 0; i < _count; i++)
+			{
+				var instance = _instances[i];
+				if (instance == null)
+				{
+					continue;
+				}
+
+				_indices[instance.Id] = count;
+				_instances[count++] = instance;
+			}
+
+			Array.Clear(_instances, count, _count - count);
+			_count = count;
+			_hasHoles = false;
+		}
+	}
+}
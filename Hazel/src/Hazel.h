@@ -18,6 +18,7 @@
 #include "Hazel/Scene/Components.h"
 
 #include "Hazel/Project/Project.h"
+#include "Hazel/Asset/AssetManager.h"
 
 // -- Renderer -----------------
 #include "Hazel/Renderer/Renderer.h"
@@ -0,0 +1,364 @@
+#include "hzpch.h"
+#include "AssetManager.h"
+
+#include "Hazel/Core/Application.h"
+#include "Hazel/Renderer/Texture.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Hazel
+{
+	// Same value as GL_LINEAR, the filter textures are created with.
+	static constexpr uint32_t kDefaultMagFilter = 0x2601;
+	static constexpr uint64_t kDefaultMemoryBudget = 512ull * 1024 * 1024;
+
+	// Uploads are spread over frames so frame time stays flat while a scene streams in, at least one is done per frame.
+	static constexpr uint32_t kMaxUploadsPerFrame = 8;
+	static constexpr uint64_t kMaxUploadBytesPerFrame = 32ull * 1024 * 1024;
+	static constexpr uint32_t kMaxDecodeWorkers = 4;
+
+	struct TextureAsset
+	{
+		std::filesystem::path FilePath;
+		uint32_t MagFilter = kDefaultMagFilter;
+
+		Ref<Texture2D> Texture = nullptr;
+		uint64_t MemorySize = 0;
+		uint64_t LastUse = 0;
+		bool IsLoading = false;
+	};
+
+	struct DecodeRequest
+	{
+		AssetHandle Handle = UUID::Invalid;
+		std::filesystem::path FilePath;
+	};
+
+	struct DecodedTexture
+	{
+		AssetHandle Handle = UUID::Invalid;
+		TextureImage Image;
+	};
+
+	struct AssetManagerData
+	{
+		// Decode workers and scene serialization use the registry from other threads.
+		std::mutex Mutex;
+
+		std::unordered_map<AssetHandle, TextureAsset> Textures;
+		std::unordered_map<std::string, AssetHandle> HandlesByPath;
+		Ref<Texture2D> LoadingTexture = nullptr;
+
+		std::vector<std::thread> DecodeWorkers;
+		std::condition_variable DecodeCondition;
+		std::deque<DecodeRequest> DecodeRequests;
+		std::deque<DecodedTexture> DecodedTextures;
+		bool IsUploadScheduled = false;
+		bool IsShuttingDown = false;
+
+		uint64_t UseCounter = 0;
+		uint64_t LoadVersion = 0;
+		AssetManager::Statistics Stats;
+	};
+
+	static AssetManagerData* sAssetData = nullptr;
+
+	// Expects the mutex to be held.
+	static void RequestDecode(AssetHandle handle, TextureAsset& asset)
+	{
+		asset.IsLoading = true;
+		sAssetData->DecodeRequests.push_back({handle, asset.FilePath});
+		sAssetData->DecodeCondition.notify_one();
+	}
+
+	void AssetManager::Init()
+	{
+		sAssetData = new AssetManagerData();
+		sAssetData->Stats.MemoryBudget = kDefaultMemoryBudget;
+
+		sAssetData->LoadingTexture = Texture2D::Create(TextureSpecification());
+		constexpr uint8_t data[4] = {128, 128, 128, 255};
+		sAssetData->LoadingTexture->SetData((void*)data, 4);
+
+		const uint32_t workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, kMaxDecodeWorkers);
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			sAssetData->DecodeWorkers.emplace_back(&AssetManager::DecodeTextures);
+		}
+	}
+
+	void AssetManager::Shutdown()
+	{
+		{
+			std::scoped_lock lock(sAssetData->Mutex);
+			sAssetData->IsShuttingDown = true;
+		}
+		sAssetData->DecodeCondition.notify_all();
+
+		for (auto& worker : sAssetData->DecodeWorkers)
+		{
+			worker.join();
+		}
+
+		delete sAssetData;
+		sAssetData = nullptr;
+	}
+
+	AssetHandle AssetManager::ImportTexture(const std::filesystem::path& filePath)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const auto key = filePath.lexically_normal().string();
+
+		std::scoped_lock lock(sAssetData->Mutex);
+		if (const auto it = sAssetData->HandlesByPath.find(key); it != sAssetData->HandlesByPath.end())
+		{
+			return it->second;
+		}
+
+		const AssetHandle handle;
+		auto& asset = sAssetData->Textures[handle];
+		asset.FilePath = key;
+		asset.LastUse = ++sAssetData->UseCounter;
+		sAssetData->HandlesByPath[key] = handle;
+
+		RequestDecode(handle, asset);
+		return handle;
+	}
+
+	Ref<Texture2D> AssetManager::GetTexture(AssetHandle handle)
+	{
+		if (handle == UUID::Invalid)
+		{
+			return nullptr;
+		}
+
+		std::scoped_lock lock(sAssetData->Mutex);
+		const auto it = sAssetData->Textures.find(handle);
+		if (it == sAssetData->Textures.end())
+		{
+			return nullptr;
+		}
+
+		auto& asset = it->second;
+		asset.LastUse = ++sAssetData->UseCounter;
+		if (asset.Texture == nullptr)
+		{
+			// Evicted, it is loaded again.
+			if (!asset.IsLoading)
+			{
+				RequestDecode(handle, asset);
+			}
+
+			return sAssetData->LoadingTexture;
+		}
+
+		return asset.Texture;
+	}
+
+	bool AssetManager::IsTextureLoaded(AssetHandle handle)
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		const auto it = sAssetData->Textures.find(handle);
+		return it != sAssetData->Textures.end() && it->second.Texture != nullptr;
+	}
+
+	bool AssetManager::IsAssetHandleValid(AssetHandle handle)
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		return handle != UUID::Invalid && sAssetData->Textures.find(handle) != sAssetData->Textures.end();
+	}
+
+	std::filesystem::path AssetManager::GetAssetPath(AssetHandle handle)
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		const auto it = sAssetData->Textures.find(handle);
+		return it != sAssetData->Textures.end() ? it->second.FilePath : std::filesystem::path();
+	}
+
+	uint32_t AssetManager::GetTextureMagFilter(AssetHandle handle)
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		const auto it = sAssetData->Textures.find(handle);
+		return it != sAssetData->Textures.end() ? it->second.MagFilter : 0;
+	}
+
+	void AssetManager::SetTextureMagFilter(AssetHandle handle, uint32_t magFilter)
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		const auto it = sAssetData->Textures.find(handle);
+		if (it == sAssetData->Textures.end())
+		{
+			return;
+		}
+
+		auto& asset = it->second;
+		asset.MagFilter = magFilter;
+		if (asset.Texture != nullptr)
+		{
+			asset.Texture->SetMagFilter(magFilter);
+		}
+	}
+
+	uint64_t AssetManager::GetLoadVersion()
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		return sAssetData->LoadVersion;
+	}
+
+	void AssetManager::SetMemoryBudget(uint64_t bytes)
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+		sAssetData->Stats.MemoryBudget = bytes;
+		EvictUnusedTextures(UINT64_MAX);
+	}
+
+	AssetManager::Statistics AssetManager::GetStatistics()
+	{
+		std::scoped_lock lock(sAssetData->Mutex);
+
+		auto stats = sAssetData->Stats;
+		stats.AssetCount = static_cast<uint32_t>(sAssetData->Textures.size());
+		for (const auto& [handle, asset] : sAssetData->Textures)
+		{
+			stats.LoadedCount += asset.Texture != nullptr;
+			stats.PendingCount += asset.IsLoading;
+		}
+		return stats;
+	}
+
+	void AssetManager::DecodeTextures()
+	{
+		while (true)
+		{
+			DecodeRequest request;
+			{
+				std::unique_lock lock(sAssetData->Mutex);
+				sAssetData->DecodeCondition.wait(lock, [] { return sAssetData->IsShuttingDown || !sAssetData->DecodeRequests.empty(); });
+				if (sAssetData->IsShuttingDown)
+				{
+					return;
+				}
+
+				request = std::move(sAssetData->DecodeRequests.front());
+				sAssetData->DecodeRequests.pop_front();
+			}
+
+			DecodedTexture decoded;
+			decoded.Handle = request.Handle;
+			decoded.Image = Texture2D::Decode(request.FilePath);
+
+			bool shouldScheduleUpload = false;
+			{
+				std::scoped_lock lock(sAssetData->Mutex);
+				sAssetData->DecodedTextures.push_back(std::move(decoded));
+				shouldScheduleUpload = !sAssetData->IsUploadScheduled;
+				sAssetData->IsUploadScheduled = true;
+			}
+
+			if (shouldScheduleUpload)
+			{
+				Application::Get().SubmitToMainThread(&AssetManager::UploadDecodedTextures);
+			}
+		}
+	}
+
+	void AssetManager::UploadDecodedTextures()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (sAssetData == nullptr)
+		{
+			return;
+		}
+
+		std::vector<DecodedTexture> uploads;
+		{
+			std::scoped_lock lock(sAssetData->Mutex);
+
+			uint64_t uploadBytes = 0;
+			auto& decodedTextures = sAssetData->DecodedTextures;
+			while (!decodedTextures.empty() && uploads.size() < kMaxUploadsPerFrame && uploadBytes < kMaxUploadBytesPerFrame)
+			{
+				uploadBytes += decodedTextures.front().Image.Pixels.size();
+				uploads.push_back(std::move(decodedTextures.front()));
+				decodedTextures.pop_front();
+			}
+		}
+
+		// The registry stays available to the workers while the pixels are uploaded.
+		std::vector<Ref<Texture2D>> textures;
+		textures.reserve(uploads.size());
+		for (const auto& upload : uploads)
+		{
+			textures.push_back(Texture2D::Create(upload.Image));
+		}
+
+		bool hasMoreUploads = false;
+		{
+			std::scoped_lock lock(sAssetData->Mutex);
+
+			const uint64_t uploadUse = sAssetData->UseCounter + 1;
+			for (size_t i = 0; i < uploads.size(); i++)
+			{
+				auto& asset = sAssetData->Textures.at(uploads[i].Handle);
+				asset.Texture = textures[i];
+				asset.Texture->SetMagFilter(asset.MagFilter);
+				asset.MemorySize = asset.Texture->GetMemorySize();
+				asset.LastUse = ++sAssetData->UseCounter;
+				asset.IsLoading = false;
+
+				sAssetData->Stats.LoadCount++;
+				sAssetData->Stats.MemoryUsage += asset.MemorySize;
+			}
+
+			sAssetData->LoadVersion++;
+			EvictUnusedTextures(uploadUse);
+
+			hasMoreUploads = !sAssetData->DecodedTextures.empty();
+			sAssetData->IsUploadScheduled = hasMoreUploads;
+		}
+
+		if (hasMoreUploads)
+		{
+			Application::Get().SubmitToMainThread(&AssetManager::UploadDecodedTextures);
+		}
+	}
+
+	// Expects the mutex to be held. Textures used since keptSinceUse are kept, so are the ones also referenced outside the manager,
+	// by the renderer or a baked batch.
+	void AssetManager::EvictUnusedTextures(uint64_t keptSinceUse)
+	{
+		auto& stats = sAssetData->Stats;
+		if (stats.MemoryUsage <= stats.MemoryBudget)
+		{
+			return;
+		}
+
+		std::vector<TextureAsset*> candidates;
+		for (auto& [handle, asset] : sAssetData->Textures)
+		{
+			if (asset.Texture != nullptr && asset.LastUse < keptSinceUse && asset.Texture.use_count() == 1)
+			{
+				candidates.push_back(&asset);
+			}
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const TextureAsset* a, const TextureAsset* b) { return a->LastUse < b->LastUse; });
+		for (auto* asset : candidates)
+		{
+			if (stats.MemoryUsage <= stats.MemoryBudget)
+			{
+				break;
+			}
+
+			stats.MemoryUsage -= asset->MemorySize;
+			stats.EvictionCount++;
+			asset->Texture = nullptr;
+			asset->MemorySize = 0;
+		}
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "Hazel/Core/UUID.h"
+
+namespace Hazel
+{
+	class Texture2D;
+
+	using AssetHandle = UUID;
+
+	// Assets are registered once per file and referenced by handle, every component using a file shares the same texture.
+	// Files are decoded on worker threads and uploaded on the main thread a few per frame, a placeholder is used meanwhile.
+	// Loaded textures only referenced by the manager are evicted least recently used first once over the memory budget,
+	// their handle stays valid and the file is loaded again on the next use.
+	class AssetManager
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		// Returns immediately, with the handle already registered for the file if any.
+		static AssetHandle ImportTexture(const std::filesystem::path& filePath);
+		// The loading placeholder until the texture is uploaded.
+		static Ref<Texture2D> GetTexture(AssetHandle handle);
+		static bool IsTextureLoaded(AssetHandle handle);
+
+		static bool IsAssetHandleValid(AssetHandle handle);
+		static std::filesystem::path GetAssetPath(AssetHandle handle);
+
+		// The filter is kept with the asset so it survives eviction.
+		static uint32_t GetTextureMagFilter(AssetHandle handle);
+		static void SetTextureMagFilter(AssetHandle handle, uint32_t magFilter);
+
+		// Changes every time a texture finishes loading, anything built with the placeholder is out of date.
+		static uint64_t GetLoadVersion();
+
+		static void SetMemoryBudget(uint64_t bytes);
+
+		struct Statistics
+		{
+			uint32_t AssetCount = 0;
+			uint32_t LoadedCount = 0;
+			uint32_t PendingCount = 0;
+			uint32_t LoadCount = 0;
+			uint32_t EvictionCount = 0;
+			uint64_t MemoryUsage = 0;
+			uint64_t MemoryBudget = 0;
+		};
+
+		static Statistics GetStatistics();
+
+	private:
+		static void DecodeTextures();
+		static void UploadDecodedTextures();
+		static void EvictUnusedTextures(uint64_t keptSinceUse);
+	};
+}
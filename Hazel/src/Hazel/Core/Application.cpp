@@ -5,6 +5,7 @@
 #include "Hazel/Renderer/Renderer.h"
 #include "Hazel/Scripting/ScriptEngine.h"
 #include "Hazel/Audio/AudioEngine.h"
+#include "Hazel/Asset/AssetManager.h"
 #include "Platform/Platform.h"
 
 namespace Hazel
@@ -40,7 +41,8 @@ namespace Hazel
 
 		AudioEngine::Init();
 		ScriptEngine::Init();
-		Renderer::Init();
+		Renderer::Init(_specification.InstancedRenderer2D);
+		AssetManager::Init();
 
 		// TODO move somewhere else?
 		Texture2D::ErrorTexture = []
@@ -52,8 +54,11 @@ namespace Hazel
 		}();
 
 		// Create ImGui and push it to the layer stack as an overlay.
+		// Headless builds have no window for its platform and OpenGL backends.
+#ifndef HZ_HEADLESS
 		_imGuiLayer = new ImGuiLayer();
 		PushOverlay(_imGuiLayer);
+#endif // HZ_HEADLESS
 	}
 
 	Application::~Application()
@@ -62,6 +67,7 @@ namespace Hazel
 
 		AudioEngine::Shutdown();
 		ScriptEngine::Shutdown();
+		AssetManager::Shutdown();
 		Renderer::Shutdown();
 		delete Time::_sInstance;
 	}
@@ -100,17 +106,22 @@ namespace Hazel
 					}
 				}
 
-				_imGuiLayer->Begin();
+				if (_imGuiLayer)
 				{
-					HZ_PROFILE_SCOPE("OnImGuiRender LayerStack Update");
-
-					// Render the ImGui layer.			
-					for (auto* layer : _layerStack)
+					_imGuiLayer->Begin();
 					{
-						layer->OnImGuiRender();
+						HZ_PROFILE_SCOPE("OnImGuiRender LayerStack Update");
+
+						// Render the ImGui layer.			
+						for (auto* layer : _layerStack)
+						{
+							layer->OnImGuiRender();
+						}
 					}
+					_imGuiLayer->End();
 				}
-				_imGuiLayer->End();
+
+				Renderer::EndFrame();
 			}
 
 			_window->OnUpdate();
@@ -203,14 +214,17 @@ namespace Hazel
 
 	void Application::ExecuteMainThreadQueue()
 	{
-		std::scoped_lock<std::mutex> lock(_mainThreadQueueMutex);
+		// Functions run outside the lock, they may submit more work which runs next frame.
+		std::vector<std::function<void()>> mainThreadQueue;
+		{
+			std::scoped_lock<std::mutex> lock(_mainThreadQueueMutex);
+			std::swap(mainThreadQueue, _mainThreadQueue);
+		}
 
-		for (auto& function : _mainThreadQueue)
+		for (auto& function : mainThreadQueue)
 		{
 			function();
 		}
-
-		_mainThreadQueue.clear();
 	}
 	
 	bool Application::IsMainThread()
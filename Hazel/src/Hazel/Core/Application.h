@@ -27,6 +27,7 @@ namespace Hazel
 		std::string Name = "Hazel Application";
 		std::string WorkingDirectory;
 		ApplicationCommandLineArgs CommandLineArgs;
+		bool InstancedRenderer2D = false; // See Renderer2D::Init.
 	};
 
 	/// <summary>
@@ -64,7 +65,7 @@ namespace Hazel
 	private:
 		ApplicationSpecification _specification;
 		Scope<Window> _window;
-		ImGuiLayer* _imGuiLayer;
+		ImGuiLayer* _imGuiLayer = nullptr; // Null in headless builds.
 		LayerStack _layerStack;
 		bool _running = true;
 		bool _minimized = false;
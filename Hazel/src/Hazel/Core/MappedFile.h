@@ -0,0 +1,30 @@
+#pragma once
+
+namespace Hazel
+{
+	// Read-only view of a whole file, the pages are loaded on access instead of being read up front.
+	class MappedFile
+	{
+	public:
+		MappedFile(const std::filesystem::path& filePath);
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		const uint8_t* GetData() const { return _data; }
+		uint64_t GetSize() const { return _size; }
+
+		operator bool() const
+		{
+			return _data != nullptr;
+		}
+
+	private:
+		const uint8_t* _data = nullptr;
+		uint64_t _size = 0;
+
+		void* _fileHandle = nullptr;
+		void* _mappingHandle = nullptr;
+	};
+}
@@ -1,6 +1,10 @@
 #pragma  once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace Hazel
 {
@@ -28,6 +32,40 @@ namespace Hazel
 			return Elapsed() * 1000.0f;
 		}
 
+		// Benchmarks keep the fastest of their runs, the slower ones mostly measure the rest of the frame.
+		template<typename Run>
+		static float MeasureFastestMillis(uint32_t iterations, Run run)
+		{
+			return MeasureFastestMillis(iterations, [] {}, run);
+		}
+
+		// setup is called before each run and left out of the timing, the state it returns is passed to run.
+		template<typename Setup, typename Run>
+		static float MeasureFastestMillis(uint32_t iterations, Setup setup, Run run)
+		{
+			float fastestMillis = std::numeric_limits<float>::max();
+			for (uint32_t iteration = 0; iteration < iterations; iteration++)
+			{
+				if constexpr (std::is_void_v<std::invoke_result_t<Setup>>)
+				{
+					setup();
+
+					Timer timer;
+					run();
+					fastestMillis = std::min(fastestMillis, timer.ElapsedMillis());
+				}
+				else
+				{
+					auto state = setup();
+
+					Timer timer;
+					run(state);
+					fastestMillis = std::min(fastestMillis, timer.ElapsedMillis());
+				}
+			}
+			return iterations > 0 ? fastestMillis : 0.0f;
+		}
+
 	private:
 		std::chrono::time_point<std::chrono::high_resolution_clock> _start;
 	};
@@ -0,0 +1,44 @@
+#include "hzpch.h"
+#include "Frustum.h"
+
+namespace Hazel
+{
+	Frustum::Frustum(const glm::mat4& viewProjection)
+	{
+		// Gribb-Hartmann, glm matrices are column major so rows are gathered across columns.
+		glm::vec4 rows[4];
+		for (int i = 0; i < 4; i++)
+		{
+			rows[i] = {viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]};
+		}
+
+		_planes[0] = rows[3] + rows[0]; // Left
+		_planes[1] = rows[3] - rows[0]; // Right
+		_planes[2] = rows[3] + rows[1]; // Bottom
+		_planes[3] = rows[3] - rows[1]; // Top
+		_planes[4] = rows[3] + rows[2]; // Near
+		_planes[5] = rows[3] - rows[2]; // Far
+	}
+
+	bool Frustum::IsBoxVisible(const glm::vec3& center, const glm::vec3& extents) const
+	{
+		for (const auto& plane : _planes)
+		{
+			const glm::vec3 normal = glm::vec3(plane);
+			// Distance of the box corner furthest along the normal, the planes don't need to be normalized for the sign.
+			if (glm::dot(normal, center) + glm::dot(glm::abs(normal), extents) + plane.w < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Frustum::GetQuadBounds(const glm::mat4& transform, glm::vec3& outCenter, glm::vec3& outExtents)
+	{
+		// The quad corners are at +-0.5 along the first two axes.
+		outCenter = glm::vec3(transform[3]);
+		outExtents = 0.5f * (glm::abs(glm::vec3(transform[0])) + glm::abs(glm::vec3(transform[1])));
+	}
+}
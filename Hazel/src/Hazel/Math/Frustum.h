@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace Hazel
+{
+	// The six clip planes of a view projection matrix, their normals point inside.
+	class Frustum
+	{
+	public:
+		Frustum() = default;
+		Frustum(const glm::mat4& viewProjection);
+
+		// Conservative, a box close to a frustum corner may be reported visible while being outside.
+		bool IsBoxVisible(const glm::vec3& center, const glm::vec3& extents) const;
+
+		// World bounds of the unit quad Renderer2D draws quads and circles from.
+		static void GetQuadBounds(const glm::mat4& transform, glm::vec3& outCenter, glm::vec3& outExtents);
+
+	private:
+		glm::vec4 _planes[6] = {};
+	};
+}
@@ -4,6 +4,7 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLBuffer.h"
+#include "Platform/Null/NullBuffer.h"
 
 namespace Hazel
 {
@@ -12,8 +13,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullVertexBuffer>(size);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLVertexBuffer>(size);
 		case RendererAPI::API::DirectX:
@@ -33,8 +33,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullVertexBuffer>(vertices, size);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLVertexBuffer>(vertices, size);
 		case RendererAPI::API::DirectX:
@@ -49,13 +48,32 @@ namespace Hazel
 		}
 	}
 
-	Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count)
+	Ref<VertexBuffer> VertexBuffer::CreateStreaming(uint32_t batchSize, uint32_t batchesPerFrame, uint32_t frameCount)
 	{
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
+			return CreateRef<NullVertexBuffer>(batchSize);
+		case RendererAPI::API::OpenGL:
+			return CreateRef<OpenGLVertexBuffer>(batchSize, batchesPerFrame, frameCount);
+		case RendererAPI::API::DirectX:
+			HZ_CORE_ASSERT(false, "RendererAPI::DirectX is currently not supported.");
 			return nullptr;
+		case RendererAPI::API::Vulkan:
+			HZ_CORE_ASSERT(false, "RendererAPI::Vulkan is currently not supported.");
+			return nullptr;
+		default:
+			HZ_CORE_ASSERT(false, "Unknown RendererAPI, VertexBuffer::CreateStreaming");
+			return nullptr;
+		}
+	}
+
+	Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			return CreateRef<NullIndexBuffer>(indices, count);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLIndexBuffer>(indices, count);
 		case RendererAPI::API::DirectX:
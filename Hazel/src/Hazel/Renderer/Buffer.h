@@ -63,13 +63,15 @@ namespace Hazel
 	{
 	public:
 		BufferLayout() = default;
-		BufferLayout(std::initializer_list<BufferElement> element)
-			: _elements(element)
+		// A per instance layout advances once per instance instead of once per vertex.
+		BufferLayout(std::initializer_list<BufferElement> element, bool perInstance = false)
+			: _elements(element), _perInstance(perInstance)
 		{
 			CalculateOffsetAndStride();
 		}
 
 		uint32_t GetStride() const { return _stride; }
+		bool IsPerInstance() const { return _perInstance; }
 		const std::vector<BufferElement>& GetElement() const { return _elements; }
 
 		std::vector<BufferElement>::iterator begin() { return _elements.begin(); }
@@ -93,6 +95,7 @@ namespace Hazel
 	private:
 		std::vector<BufferElement> _elements;
 		uint32_t _stride = 0;
+		bool _perInstance = false;
 	};
 
 	class VertexBuffer
@@ -108,8 +111,24 @@ namespace Hazel
 		virtual const BufferLayout& GetLayout() = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 
+		// A streaming buffer is persistently mapped and holds a few frames worth of batches.
+		// Each batch writes its vertices straight into the mapped memory instead of calling SetData.
+		virtual bool IsStreaming() const { return false; }
+		// Writable memory for the next batch, room for at least one full batch. nullptr when the buffer is not streaming.
+		virtual void* GetMappedRegion() { return nullptr; }
+		// Offset in bytes of the next batch from the start of the buffer.
+		virtual uint32_t GetMappedRegionOffset() const { return 0; }
+		// Call once the draw reading the batch was submitted, with the number of bytes it wrote.
+		// The next batch is placed right after it in the same frame, without any synchronization.
+		virtual void AdvanceRegion(uint32_t size) {}
+		// Fences the batches written this frame, then waits if the GPU is still reading the frame reused next.
+		virtual void EndFrame() {}
+
 		static Ref<VertexBuffer> Create(uint32_t size);
 		static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
+		// Every frame gets batchesPerFrame full batches of room, shared by as many smaller batches as fit.
+		// Falls back to a regular dynamic buffer of batchSize when persistent mapping is not supported.
+		static Ref<VertexBuffer> CreateStreaming(uint32_t batchSize, uint32_t batchesPerFrame, uint32_t frameCount = 3);
 	};
 
 	// Currently only support 32-bits index buffers
@@ -3,6 +3,7 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLFramebuffer.h"
+#include "Platform/Null/NullFramebuffer.h"
 
 namespace Hazel
 {
@@ -11,8 +12,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullFramebuffer>(spec);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLFramebuffer>(spec);
 		case RendererAPI::API::DirectX:
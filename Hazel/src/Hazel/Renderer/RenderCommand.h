@@ -20,18 +20,25 @@ namespace Hazel
 			_sRendererAPI->SetViewport(x, y, width, height);
 		}
 
-		static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0)
+		static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0)
 		{
 			HZ_PROFILE_FUNCTION();
 
-			_sRendererAPI->DrawIndexed(vertexArray, indexCount);
+			_sRendererAPI->DrawIndexed(vertexArray, indexCount, baseVertex);
 		}
 
-		static void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount)
+		static void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0)
 		{
 			HZ_PROFILE_FUNCTION();
 
-			_sRendererAPI->DrawLines(vertexArray, vertexCount);
+			_sRendererAPI->DrawLines(vertexArray, vertexCount, firstVertex);
+		}
+
+		static void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0)
+		{
+			HZ_PROFILE_FUNCTION();
+
+			_sRendererAPI->DrawInstanced(vertexArray, vertexCount, instanceCount, baseInstance);
 		}
 
 		static void SetClearColor(const Color& color)
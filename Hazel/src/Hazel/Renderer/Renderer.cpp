@@ -2,18 +2,16 @@
 #include "Renderer.h"
 #include "Renderer2D.h"
 
-#include "Platform/OpenGL/OpenGLShader.h"
-
 namespace Hazel
 {
 	Scope<Renderer::SceneData> Renderer::_sSceneData = CreateScope<SceneData>();
 
-	void Renderer::Init()
+	void Renderer::Init(bool instancedRenderer2D)
 	{
 		HZ_PROFILE_FUNCTION();
 
 		RenderCommand::Init();
-		Renderer2D::Init();
+		Renderer2D::Init(instancedRenderer2D);
 	}
 
 	void Renderer::Shutdown()
@@ -28,6 +26,13 @@ namespace Hazel
 		RenderCommand::SetViewport(0, 0, width, height);
 	}
 
+	void Renderer::EndFrame()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		Renderer2D::EndFrame();
+	}
+
 	void Renderer::BeginScene(const OrthographicCamera& camera)
 	{
 		HZ_PROFILE_FUNCTION();
@@ -42,8 +47,8 @@ namespace Hazel
 		HZ_PROFILE_FUNCTION();
 
 		shader->Bind();
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_ViewProjection", _sSceneData->ViewProjectionMatrix);
-		std::dynamic_pointer_cast<OpenGLShader>(shader)->UploadUniformMat4("u_Transform", transform);
+		shader->SetMat4("u_ViewProjection", _sSceneData->ViewProjectionMatrix);
+		shader->SetMat4("u_Transform", transform);
 
 		vertexArray->Bind();
 		RenderCommand::DrawIndexed(vertexArray);
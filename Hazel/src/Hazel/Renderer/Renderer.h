@@ -10,9 +10,10 @@ namespace Hazel
 	class Renderer
 	{
 	public:
-		static void Init();
+		static void Init(bool instancedRenderer2D = false);
 		static void Shutdown();
 		static void OnWindowResize(uint32_t width, uint32_t height);
+		static void EndFrame();
 
 		static void BeginScene(const OrthographicCamera& camera);
 		static void EndScene();
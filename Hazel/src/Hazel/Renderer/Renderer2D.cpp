@@ -7,11 +7,21 @@
 #include "RenderCommand.h"
 #include "MSDFData.h"
 
+#include "Hazel/Core/Timer.h"
+
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/packing.hpp>
 
 #include <future>
 
+#if defined(_M_X64) || defined(__SSE2__)
+#	define HZ_RENDERER2D_SIMD 1
+#	include <immintrin.h>
+#else
+#	define HZ_RENDERER2D_SIMD 0
+#endif // _M_X64 || __SSE2__
+
 namespace Hazel
 {
 	struct QuadVertex
@@ -38,6 +48,92 @@ namespace Hazel
 		int EntityID;
 	};
 
+	// Instanced mode, one record per quad. The quad spans [-0.5, 0.5] along AxisX and AxisY around Center,
+	// these are the first, second and last column of the transform.
+	struct QuadInstance
+	{
+		glm::vec3 AxisX;
+		glm::vec3 AxisY;
+		glm::vec3 Center;
+		uint32_t Color; // RGBA8
+		glm::vec4 UVRect; // min.x, min.y, max.x, max.y, already scaled by the tiling factor.
+		int TextureIndex;
+
+		// Editor-Only
+		int EntityID;
+	};
+
+	struct CircleInstance
+	{
+		glm::vec3 AxisX;
+		glm::vec3 AxisY;
+		glm::vec3 Center;
+		uint32_t Color; // RGBA8
+		float Thickness;
+		float Fade;
+
+		// Editor-Only
+		int EntityID;
+	};
+
+	enum class QueuedPrimitive : uint8_t
+	{
+		Quad = 0,
+		Circle = 1,
+		StaticChunk = 2
+	};
+
+	// Quads sharing few enough textures to be drawn in one call, in buffers that are never rewritten.
+	struct Renderer2D::StaticBatch
+	{
+		struct Chunk
+		{
+			Ref<VertexArray> Vertices;
+			std::vector<Ref<Texture2D>> Textures; // Bound at slot = index.
+			uint32_t QuadCount = 0;
+			glm::vec3 Center{0.0f};
+			bool IsTranslucent = false;
+		};
+
+		std::vector<Chunk> Chunks;
+	};
+
+	// A quad or circle recorded between BeginScene and EndScene, drawn in sort key order.
+	struct QueuedDraw
+	{
+		glm::mat4 Transform;
+		Color Color;
+		Ref<Texture2D> Texture; // Quads only, nullptr draws a flat color.
+		glm::vec4 UVRect; // Quads only, min.x, min.y, max.x, max.y
+		glm::vec2 TilingFactor; // Quads only.
+		float Thickness; // Circles only.
+		float Fade; // Circles only.
+		int EntityID;
+		QueuedPrimitive Primitive;
+		const Renderer2D::StaticBatch::Chunk* StaticChunk = nullptr; // Static chunks only, kept alive by the caller until EndScene.
+	};
+
+	struct QueuedDrawKey
+	{
+		uint64_t Key;
+		uint32_t Index; // Into QueuedDraws.
+	};
+
+	// A texture array holding copies of textures with the same size, format and filter.
+	struct TextureArrayPage
+	{
+		Ref<Texture2DArray> Array;
+		uint32_t NextLayer = 0; // Layers from here on were never handed out.
+		std::vector<uint32_t> FreeLayers; // Layers of destroyed textures.
+	};
+
+	struct TextureResidency
+	{
+		std::weak_ptr<Texture2D> Texture; // Expired once the texture is destroyed, its renderer ID may then be reused.
+		uint32_t Page;
+		uint32_t Layer;
+	};
+
 	struct LineVertex
 	{
 		glm::vec3 Position;
@@ -65,15 +161,25 @@ namespace Hazel
 		static constexpr uint32_t MaxVertices = MaxQuads * 4; // 80,000
 		static constexpr uint32_t MaxIndices = MaxQuads * 6; // 120,000
 		static constexpr uint32_t MaxTextureSlots = 32; // TODO: Render Capabilities
+		// The last slots hold texture arrays, the quad shaders declare the same split.
+		static constexpr uint32_t kTextureArraySlots = 4;
+		static constexpr uint32_t kTexture2DSlots = MaxTextureSlots - kTextureArraySlots;
+
+		// Frames the GPU may still be reading while the next one is written, per streaming vertex buffer.
+		static constexpr uint32_t kStreamingFrameCount = 3;
+		// Room for this many full batches per frame, smaller batches share it until it runs out.
+		static constexpr uint32_t kStreamingBatchesPerFrame = 2;
 
 #pragma region Quad
 		Ref<VertexArray> QuadVertexArray;
 		Ref<VertexBuffer> QuadVertexBuffer;
+		Ref<IndexBuffer> QuadIndexBuffer; // Shared by every indexed quad shaped draw.
 		Ref<Shader> QuadShader;
 
 		uint32_t QuadIndexCount = 0;
 		QuadVertex* QuadVertexBufferBase = nullptr;
 		QuadVertex* QuadVertexBufferPtr = nullptr;
+		QuadVertex* QuadVertexStaging = nullptr; // Only used when QuadVertexBuffer is not streaming.
 #pragma endregion
 
 #pragma region Circle
@@ -84,6 +190,41 @@ namespace Hazel
 		uint32_t CircleIndexCount = 0;
 		CircleVertex* CircleVertexBufferBase = nullptr;
 		CircleVertex* CircleVertexBufferPtr = nullptr;
+		CircleVertex* CircleVertexStaging = nullptr; // Only used when CircleVertexBuffer is not streaming.
+#pragma endregion
+
+#pragma region Instanced
+		// Quads and circles are written as instances instead of vertices, the index counts above still track capacity.
+		bool Instanced = false;
+
+		Ref<VertexArray> QuadInstanceVertexArray;
+		Ref<VertexBuffer> QuadInstanceBuffer;
+		QuadInstance* QuadInstanceBufferBase = nullptr;
+		QuadInstance* QuadInstanceBufferPtr = nullptr;
+		QuadInstance* QuadInstanceStaging = nullptr;
+
+		Ref<VertexArray> CircleInstanceVertexArray;
+		Ref<VertexBuffer> CircleInstanceBuffer;
+		CircleInstance* CircleInstanceBufferBase = nullptr;
+		CircleInstance* CircleInstanceBufferPtr = nullptr;
+		CircleInstance* CircleInstanceStaging = nullptr;
+#pragma endregion
+
+#pragma region Queue
+		std::vector<QueuedDraw> QueuedDraws;
+		std::vector<QueuedDrawKey> QueuedDrawKeys;
+		std::vector<QueuedDrawKey> QueuedDrawKeysScratch; // Radix sort ping-pong buffer.
+#pragma endregion
+
+#pragma region Texture Arrays
+		bool TextureArraysEnabled = false;
+
+		std::vector<TextureArrayPage> TextureArrayPages;
+		std::unordered_map<uint32_t, TextureResidency> TextureResidencies; // Keyed by texture renderer ID.
+
+		// Pages bound in the current batch, at slot kTexture2DSlots + index.
+		std::array<uint32_t, kTextureArraySlots> TextureArraySlotPages;
+		uint32_t TextureArraySlotIndex = 0;
 #pragma endregion
 
 #pragma region Line
@@ -94,6 +235,7 @@ namespace Hazel
 		uint32_t LineVertexCount = 0;
 		LineVertex* LineVertexBufferBase = nullptr;
 		LineVertex* LineVertexBufferPtr = nullptr;
+		LineVertex* LineVertexStaging = nullptr; // Only used when LineVertexBuffer is not streaming.
 
 		float LineWidth = 2.0f;
 #pragma endregion
@@ -106,13 +248,38 @@ namespace Hazel
 		uint32_t TextIndexCount = 0;
 		TextVertex* TextVertexBufferBase = nullptr;
 		TextVertex* TextVertexBufferPtr = nullptr;
+		TextVertex* TextVertexStaging = nullptr; // Only used when TextVertexBuffer is not streaming.
 
 		Ref<Texture2D> FontAtlasTexture;
 #pragma endregion
 
-		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
+		std::array<Ref<Texture2D>, kTexture2DSlots> TextureSlots;
 		uint32_t TextureSlotIndex = 0;
 
+		// Sprite textures resolved through the AssetManager once per frame, cleared by EndFrame so unused ones can be evicted.
+		std::unordered_map<AssetHandle, Ref<Texture2D>> SpriteTextures;
+		AssetHandle LastSpriteTextureHandle = UUID::Invalid;
+		const Ref<Texture2D>* LastSpriteTexture = nullptr;
+
+		// Open-addressed map from texture renderer ID to its texture index in the current batch.
+		// Entries written before the last Reset() have an older generation and count as empty.
+		struct TextureSlotEntry
+		{
+			uint32_t RendererID = 0;
+			int Index = 0;
+			uint32_t Generation = 0;
+		};
+
+		// Textures in arrays don't take a slot, so the table is sized for many more textures than slots.
+		static constexpr uint32_t kTextureSlotTableBits = 10;
+		static constexpr uint32_t kTextureSlotTableSize = 1 << kTextureSlotTableBits;
+		static constexpr uint32_t kMaxResolvedTextures = kTextureSlotTableSize / 2; // Keeps the load factor under 0.5.
+		static_assert(kTexture2DSlots <= kMaxResolvedTextures, "Texture slot table is too small for the texture slots");
+
+		std::array<TextureSlotEntry, kTextureSlotTableSize> TextureSlotTable;
+		uint32_t TextureSlotGeneration = 1;
+		uint32_t ResolvedTextureCount = 0;
+
 		static constexpr uint8_t kQuadVertexCount = 4;
 		glm::vec4 QuadVertexPositions[4];
 		glm::vec2* QuadTextureCoordinates = nullptr;
@@ -130,27 +297,709 @@ namespace Hazel
 	static Renderer2DData sData;
 	static std::future<void> sAsyncShaderCreation;
 
-	void Renderer2D::Init()
+	// Streaming buffers are written in place, otherwise vertices go to the staging array and are uploaded on Flush.
+	template<typename TVertex>
+	static TVertex* GetBatchBase(const Ref<VertexBuffer>& vertexBuffer, TVertex* staging)
 	{
-		HZ_PROFILE_FUNCTION();
+		void* region = vertexBuffer->GetMappedRegion();
+		return region ? static_cast<TVertex*>(region) : staging;
+	}
 
-#pragma region Quad
-		sData.QuadVertexArray = VertexArray::Create();
+	// Neighbouring sprites usually share their texture, the last one is checked before the map.
+	static const Ref<Texture2D>& GetSpriteTexture(AssetHandle handle)
+	{
+		if (sData.LastSpriteTexture && sData.LastSpriteTextureHandle == handle)
+		{
+			return *sData.LastSpriteTexture;
+		}
 
-		sData.QuadVertexBuffer = VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(QuadVertex));
-		sData.QuadVertexBuffer->SetLayout(
+		auto it = sData.SpriteTextures.find(handle);
+		if (it == sData.SpriteTextures.end())
+		{
+			it = sData.SpriteTextures.emplace(handle, AssetManager::GetTexture(handle)).first;
+		}
+
+		sData.LastSpriteTextureHandle = handle;
+		sData.LastSpriteTexture = &it->second;
+		return it->second;
+	}
+
+	static const char* GetQuadShaderPath()
+	{
+		return sData.Instanced ? SHADER_PATH_QUAD_INSTANCED : SHADER_PATH_QUAD;
+	}
+
+	static const char* GetCircleShaderPath()
+	{
+		return sData.Instanced ? SHADER_PATH_CIRCLE_INSTANCED : SHADER_PATH_CIRCLE;
+	}
+
+	static BufferLayout GetQuadVertexLayout()
+	{
+		return
+		{
+			{ ShaderDataType::Float3, "a_Position"		},
+			{ ShaderDataType::Float4, "a_Color"			},
+			{ ShaderDataType::Float2, "a_TextureCoord"	},
+			{ ShaderDataType::Int,	  "a_TextureIndex"	},
+			{ ShaderDataType::Float2, "a_TilingFactor"	},
+			{ ShaderDataType::Int,	  "a_EntityID"		},
+		};
+	}
+
+	static BufferLayout GetQuadInstanceLayout()
+	{
+		return BufferLayout(
 			{
-				{ ShaderDataType::Float3, "a_Position"		},
-				{ ShaderDataType::Float4, "a_Color"			},
-				{ ShaderDataType::Float2, "a_TextureCoord"	},
+				{ ShaderDataType::Float3, "a_AxisX"			},
+				{ ShaderDataType::Float3, "a_AxisY"			},
+				{ ShaderDataType::Float3, "a_Center"		},
+				{ ShaderDataType::Int,	  "a_Color"			},
+				{ ShaderDataType::Float4, "a_UVRect"		},
 				{ ShaderDataType::Int,	  "a_TextureIndex"	},
-				{ ShaderDataType::Float2, "a_TilingFactor"	},
 				{ ShaderDataType::Int,	  "a_EntityID"		},
-			});
-		sData.QuadVertexArray->AddVertexBuffer(sData.QuadVertexBuffer);
+			}, true);
+	}
+
+#pragma region Kernels
+	// The unit quad corners are constant (+-0.5, +-0.5, 0, 1), so for an affine transform
+	// each corner is translation +- halfX +- halfY where halfX/halfY are the first two columns scaled by 0.5.
+	// This replaces four mat4 * vec4 per quad by a handful of adds.
+
+	static void ComputeQuadCorners(const glm::mat4& transform, glm::vec3 (&corners)[4])
+	{
+		const glm::vec3 translation = transform[3];
+		const glm::vec3 halfX = glm::vec3(transform[0]) * 0.5f;
+		const glm::vec3 halfY = glm::vec3(transform[1]) * 0.5f;
+
+		corners[0] = translation - halfX - halfY;
+		corners[1] = translation + halfX - halfY;
+		corners[2] = translation + halfX + halfY;
+		corners[3] = translation - halfX + halfY;
+	}
+
+	// Kept for the benchmark, this is how vertices used to be generated.
+	static void WriteQuadVerticesReference(QuadVertex* vertices, const glm::mat4& transform, const Color& color, const glm::vec2* textureCoordinates, int textureIndex, const glm::vec2& tilingFactor, int entityID)
+	{
+		for (uint32_t i = 0; i < Renderer2DData::kQuadVertexCount; i++)
+		{
+			vertices[i].Position = transform * sData.QuadVertexPositions[i];
+			vertices[i].Color = color;
+			vertices[i].TextureCoord = textureCoordinates[i];
+			vertices[i].TextureIndex = textureIndex;
+			vertices[i].TilingFactor = tilingFactor;
+			vertices[i].EntityID = entityID;
+		}
+	}
+
+	static void WriteQuadVerticesScalar(QuadVertex* vertices, const glm::mat4& transform, const Color& color, const glm::vec2* textureCoordinates, int textureIndex, const glm::vec2& tilingFactor, int entityID)
+	{
+		glm::vec3 corners[4];
+		ComputeQuadCorners(transform, corners);
+
+		const glm::vec4 colorValue = color;
+		for (uint32_t i = 0; i < Renderer2DData::kQuadVertexCount; i++)
+		{
+			vertices[i].Position = corners[i];
+			vertices[i].Color = colorValue;
+			vertices[i].TextureCoord = textureCoordinates[i];
+			vertices[i].TextureIndex = textureIndex;
+			vertices[i].TilingFactor = tilingFactor;
+			vertices[i].EntityID = entityID;
+		}
+	}
+
+	static void WriteCircleVerticesScalar(CircleVertex* vertices, const glm::mat4& transform, const Color& color, float thickness, float fade, int entityID)
+	{
+		glm::vec3 corners[4];
+		ComputeQuadCorners(transform, corners);
+
+		const glm::vec4 colorValue = color;
+		for (uint32_t i = 0; i < Renderer2DData::kQuadVertexCount; i++)
+		{
+			vertices[i].WorldPosition = corners[i];
+			vertices[i].LocalPosition = sData.QuadVertexPositions[i] * 2.0f;
+			vertices[i].Color = colorValue;
+			vertices[i].Thickness = thickness;
+			vertices[i].Fade = fade;
+			vertices[i].EntityID = entityID;
+		}
+	}
+
+	static void WriteQuadInstance(QuadInstance* instance, const glm::mat4& transform, const Color& color, const glm::vec4& uvRect, int textureIndex, const glm::vec2& tilingFactor, int entityID)
+	{
+		instance->AxisX = transform[0];
+		instance->AxisY = transform[1];
+		instance->Center = transform[3];
+		instance->Color = glm::packUnorm4x8(glm::vec4(color));
+		instance->UVRect = uvRect * glm::vec4(tilingFactor, tilingFactor);
+		instance->TextureIndex = textureIndex;
+		instance->EntityID = entityID;
+	}
+
+	static void WriteCircleInstance(CircleInstance* instance, const glm::mat4& transform, const Color& color, float thickness, float fade, int entityID)
+	{
+		instance->AxisX = transform[0];
+		instance->AxisY = transform[1];
+		instance->Center = transform[3];
+		instance->Color = glm::packUnorm4x8(glm::vec4(color));
+		instance->Thickness = thickness;
+		instance->Fade = fade;
+		instance->EntityID = entityID;
+	}
+
+#if HZ_RENDERER2D_SIMD
+	// The SIMD stores write 4 floats, the layouts below let a position store spill into the next field
+	// which is then overwritten by the following store.
+	static_assert(offsetof(QuadVertex, Color) == sizeof(float) * 3, "QuadVertex layout changed, update WriteQuadVerticesSIMD.");
+	static_assert(offsetof(CircleVertex, LocalPosition) == sizeof(float) * 3, "CircleVertex layout changed, update WriteCircleVerticesSIMD.");
+	static_assert(offsetof(CircleVertex, Color) == sizeof(float) * 6, "CircleVertex layout changed, update WriteCircleVerticesSIMD.");
+
+	static void ComputeQuadCornersSIMD(const glm::mat4& transform, __m128 (&corners)[4])
+	{
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 halfX = _mm_mul_ps(_mm_loadu_ps(&transform[0].x), half);
+		const __m128 halfY = _mm_mul_ps(_mm_loadu_ps(&transform[1].x), half);
+		const __m128 translation = _mm_loadu_ps(&transform[3].x);
+
+		const __m128 bottom = _mm_sub_ps(translation, halfY);
+		const __m128 top = _mm_add_ps(translation, halfY);
+
+		corners[0] = _mm_sub_ps(bottom, halfX);
+		corners[1] = _mm_add_ps(bottom, halfX);
+		corners[2] = _mm_add_ps(top, halfX);
+		corners[3] = _mm_sub_ps(top, halfX);
+	}
+
+	static void WriteQuadVerticesSIMD(QuadVertex* vertices, const glm::mat4& transform, const Color& color, const glm::vec2* textureCoordinates, int textureIndex, const glm::vec2& tilingFactor, int entityID)
+	{
+		__m128 corners[4];
+		ComputeQuadCornersSIMD(transform, corners);
+
+		const __m128 colorValue = _mm_loadu_ps(&color.r);
+		for (uint32_t i = 0; i < Renderer2DData::kQuadVertexCount; i++)
+		{
+			auto* vertex = reinterpret_cast<float*>(vertices + i);
+			_mm_storeu_ps(vertex, corners[i]); // Position, w spills into Color.r
+			_mm_storeu_ps(vertex + 3, colorValue); // Color
+			vertices[i].TextureCoord = textureCoordinates[i];
+			vertices[i].TextureIndex = textureIndex;
+			vertices[i].TilingFactor = tilingFactor;
+			vertices[i].EntityID = entityID;
+		}
+	}
+
+	static void WriteCircleVerticesSIMD(CircleVertex* vertices, const glm::mat4& transform, const Color& color, float thickness, float fade, int entityID)
+	{
+		__m128 corners[4];
+		ComputeQuadCornersSIMD(transform, corners);
+
+		const __m128 colorValue = _mm_loadu_ps(&color.r);
+		for (uint32_t i = 0; i < Renderer2DData::kQuadVertexCount; i++)
+		{
+			auto* vertex = reinterpret_cast<float*>(vertices + i);
+			_mm_storeu_ps(vertex, corners[i]); // WorldPosition, w spills into LocalPosition.x
+			vertices[i].LocalPosition = sData.QuadVertexPositions[i] * 2.0f;
+			_mm_storeu_ps(vertex + 6, colorValue); // Color
+			vertices[i].Thickness = thickness;
+			vertices[i].Fade = fade;
+			vertices[i].EntityID = entityID;
+		}
+	}
+
+	static constexpr auto WriteQuadVertices = WriteQuadVerticesSIMD;
+	static constexpr auto WriteCircleVertices = WriteCircleVerticesSIMD;
+#else
+	static constexpr auto WriteQuadVertices = WriteQuadVerticesScalar;
+	static constexpr auto WriteCircleVertices = WriteCircleVerticesScalar;
+#endif // HZ_RENDERER2D_SIMD
+#pragma endregion
+
+#pragma region Queue
+	// Sort key layout, most significant bits first:
+	//	63..56 layer, 55 translucent
+	//	opaque:      54..53 primitive, 52..37 texture, 36..13 depth front to back
+	//	translucent: 54..31 depth back to front, 30..29 primitive, 28..13 texture
+	// Opaque draws are grouped by shader and texture to limit flushes, translucent ones need the depth order to blend correctly.
+	static constexpr uint64_t kSortDepthMax = (1 << 24) - 1;
+	static const glm::vec4 kFullUVRect = {0.0f, 0.0f, 1.0f, 1.0f};
+
+	static uint64_t MakeSortKey(int layer, bool translucent, float depth, QueuedPrimitive primitive, uint32_t textureID)
+	{
+		const uint64_t layerBits = static_cast<uint64_t>(std::clamp(layer, -128, 127) + 128);
+		const uint64_t depthBits = static_cast<uint64_t>(depth * static_cast<float>(kSortDepthMax));
+		const uint64_t primitiveBits = static_cast<uint64_t>(primitive);
+		const uint64_t textureBits = textureID & 0xFFFF;
+
+		uint64_t key = layerBits << 56;
+		if (translucent)
+		{
+			key |= 1ull << 55;
+			key |= (kSortDepthMax - depthBits) << 31;
+			key |= primitiveBits << 29;
+			key |= textureBits << 13;
+		}
+		else
+		{
+			key |= primitiveBits << 53;
+			key |= textureBits << 37;
+			key |= depthBits << 13;
+		}
+
+		return key;
+	}
+
+	// Normalized depth of a point, 0 at the near plane and 1 at the far plane.
+	static float ComputeSortDepth(const glm::vec3& position)
+	{
+		const glm::vec4 clip = sData.CameraBuffer.ViewProjection * glm::vec4(position, 1.0f);
+		if (clip.w <= 0.0f)
+		{
+			return 1.0f;
+		}
+
+		return glm::clamp(clip.z / clip.w * 0.5f + 0.5f, 0.0f, 1.0f);
+	}
+
+	static bool IsTranslucent(const Color& color, const Ref<Texture2D>& texture)
+	{
+		if (color.a < 1.0f)
+		{
+			return true;
+		}
+
+		if (texture)
+		{
+			const auto& specification = texture->GetSpecification();
+			return (specification.Format == ImageFormat::RGBA8 || specification.Format == ImageFormat::RGBA32F) && specification.HasTranslucency;
+		}
+
+		return false;
+	}
+
+	// LSD radix sort on the 64 bit key, 8 bits per pass. Stable, so equal keys keep their submission order.
+	// Passes where every key has the same digit are skipped.
+	static void RadixSort(std::vector<QueuedDrawKey>& keys, std::vector<QueuedDrawKey>& scratch)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const auto count = static_cast<uint32_t>(keys.size());
+		if (count < 2)
+		{
+			return;
+		}
+
+		scratch.resize(count);
+
+		uint32_t histograms[8][256] = {};
+		for (const auto& entry : keys)
+		{
+			for (uint32_t pass = 0; pass < 8; pass++)
+			{
+				histograms[pass][(entry.Key >> (pass * 8)) & 0xFF]++;
+			}
+		}
+
+		QueuedDrawKey* source = keys.data();
+		QueuedDrawKey* destination = scratch.data();
+		for (uint32_t pass = 0; pass < 8; pass++)
+		{
+			const uint32_t shift = pass * 8;
+			uint32_t* histogram = histograms[pass];
+			if (histogram[(source[0].Key >> shift) & 0xFF] == count)
+			{
+				continue;
+			}
+
+			uint32_t offset = 0;
+			for (uint32_t digit = 0; digit < 256; digit++)
+			{
+				const uint32_t digitCount = histogram[digit];
+				histogram[digit] = offset;
+				offset += digitCount;
+			}
+
+			for (uint32_t i = 0; i < count; i++)
+			{
+				destination[histogram[(source[i].Key >> shift) & 0xFF]++] = source[i];
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != keys.data())
+		{
+			keys.swap(scratch);
+		}
+	}
+
+	static void QueueQuad(const glm::mat4& transform, const Color& color, const Ref<Texture2D>& texture, const glm::vec4& uvRect, const glm::vec2& tilingFactor, int entityID, int layer)
+	{
+		const uint32_t textureID = texture ? texture->GetRendererID() : 0;
+		const uint64_t key = MakeSortKey(layer, IsTranslucent(color, texture), ComputeSortDepth(transform[3]), QueuedPrimitive::Quad, textureID);
+
+		sData.QueuedDrawKeys.push_back({key, static_cast<uint32_t>(sData.QueuedDraws.size())});
+		sData.QueuedDraws.push_back({transform, color, texture, uvRect, tilingFactor, 0.0f, 0.0f, entityID, QueuedPrimitive::Quad});
+	}
+
+	// Same as QueueQuad for every quad, the texture is resolved and checked for translucency once.
+	static void QueueQuads(const glm::mat4* transforms, const Color* colors, uint32_t count, const Ref<Texture2D>& texture, const glm::vec4* uvRects, const glm::vec2& tilingFactor, const int* entityIDs, int layer)
+	{
+		const uint32_t textureID = texture ? texture->GetRendererID() : 0;
+		const bool isTextureTranslucent = IsTranslucent(Color::White, texture);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const bool isTranslucent = isTextureTranslucent || colors[i].a < 1.0f;
+			const uint64_t key = MakeSortKey(layer, isTranslucent, ComputeSortDepth(transforms[i][3]), QueuedPrimitive::Quad, textureID);
+			const glm::vec4& uvRect = uvRects ? uvRects[i] : kFullUVRect;
+
+			sData.QueuedDrawKeys.push_back({key, static_cast<uint32_t>(sData.QueuedDraws.size())});
+			sData.QueuedDraws.push_back({transforms[i], colors[i], texture, uvRect, tilingFactor, 0.0f, 0.0f, entityIDs ? entityIDs[i] : -1, QueuedPrimitive::Quad});
+		}
+	}
+
+	// Circles fade out at their edge, they are always translucent.
+	static void QueueCircle(const glm::mat4& transform, const Color& color, float thickness, float fade, int entityID, int layer)
+	{
+		const uint64_t key = MakeSortKey(layer, true, ComputeSortDepth(transform[3]), QueuedPrimitive::Circle, 0);
+
+		sData.QueuedDrawKeys.push_back({key, static_cast<uint32_t>(sData.QueuedDraws.size())});
+		sData.QueuedDraws.push_back({transform, color, nullptr, kFullUVRect, glm::vec2(1.0f), thickness, fade, entityID, QueuedPrimitive::Circle});
+	}
+
+	// Sorted as a whole by the chunk center, the quads within keep the order they were baked in.
+	static void QueueStaticChunk(const Renderer2D::StaticBatch::Chunk& chunk, int layer)
+	{
+		const uint64_t key = MakeSortKey(layer, chunk.IsTranslucent, ComputeSortDepth(chunk.Center), QueuedPrimitive::StaticChunk, 0);
+
+		sData.QueuedDrawKeys.push_back({key, static_cast<uint32_t>(sData.QueuedDraws.size())});
+		sData.QueuedDraws.push_back({glm::mat4(1.0f), Color::White, nullptr, kFullUVRect, glm::vec2(1.0f), 0.0f, 0.0f, -1, QueuedPrimitive::StaticChunk, &chunk});
+	}
+#pragma endregion
+
+#pragma region Texture Arrays
+	// Shader side, texture indices from kTextureArrayIndexFlag on are (array slot << kTextureArraySlotShift) | layer.
+	static constexpr int kTextureArrayIndexFlag = 1 << 16;
+	static constexpr uint32_t kTextureArraySlotShift = 12;
+
+	static constexpr uint64_t kTextureArrayPageBytes = 64ull << 20; // 64 MiB
+	static constexpr uint32_t kMinTextureArrayLayers = 4; // Larger textures keep using a Texture2D slot.
+	static constexpr uint32_t kMaxTextureArrayLayers = 256;
+	static constexpr uint32_t kMaxTextureArrayPages = 16;
+	static_assert(kMaxTextureArrayLayers <= (1 << kTextureArraySlotShift), "Layer index must fit below the array slot");
+
+	static uint64_t GetTextureLayerBytes(const TextureSpecification& specification)
+	{
+		uint64_t bytesPerPixel = 0;
+		switch (specification.Format)
+		{
+		case ImageFormat::RGB8: bytesPerPixel = 3; break;
+		case ImageFormat::RGBA8: bytesPerPixel = 4; break;
+		default: break;
+		}
+
+		return static_cast<uint64_t>(specification.Width) * specification.Height * bytesPerPixel;
+	}
+
+	// Only textures loaded from a file are copied, they are not written to after loading.
+	static bool CanUseTextureArray(const Texture2D& texture)
+	{
+		if (texture.GetPath().empty())
+		{
+			return false;
+		}
+
+		const uint64_t layerBytes = GetTextureLayerBytes(texture.GetSpecification());
+		return layerBytes > 0 && texture.GetMemorySize() * kMinTextureArrayLayers <= kTextureArrayPageBytes;
+	}
 
-		sData.QuadVertexBufferBase = new QuadVertex[Renderer2DData::MaxVertices];
+	// Frees the layers of destroyed textures, returns the number of layers freed.
+	static uint32_t ReclaimTextureArrayLayers()
+	{
+		uint32_t reclaimedCount = 0;
+		for (auto it = sData.TextureResidencies.begin(); it != sData.TextureResidencies.end();)
+		{
+			if (it->second.Texture.expired())
+			{
+				sData.TextureArrayPages[it->second.Page].FreeLayers.push_back(it->second.Layer);
+				it = sData.TextureResidencies.erase(it);
+				reclaimedCount++;
+			}
+			else
+			{
+				++it;
+			}
+		}
 
+		return reclaimedCount;
+	}
+
+	static bool FindTextureArrayLayer(const Texture2D& texture, uint32_t& outPage, uint32_t& outLayer)
+	{
+		const auto& specification = texture.GetSpecification();
+		for (uint32_t pageIndex = 0; pageIndex < sData.TextureArrayPages.size(); pageIndex++)
+		{
+			auto& page = sData.TextureArrayPages[pageIndex];
+			const auto& arraySpecification = page.Array->GetSpecification();
+			if (arraySpecification.Width != specification.Width || arraySpecification.Height != specification.Height
+				|| arraySpecification.Format != specification.Format || page.Array->GetMagFilter() != texture.GetMagFilter()
+				|| page.Array->GetMipLevelCount() != texture.GetMipLevelCount())
+			{
+				continue;
+			}
+
+			if (!page.FreeLayers.empty())
+			{
+				outPage = pageIndex;
+				outLayer = page.FreeLayers.back();
+				page.FreeLayers.pop_back();
+				return true;
+			}
+
+			if (page.NextLayer < page.Array->GetLayerCount())
+			{
+				outPage = pageIndex;
+				outLayer = page.NextLayer++;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static bool AllocateTextureArrayLayer(const Texture2D& texture, uint32_t& outPage, uint32_t& outLayer)
+	{
+		if (FindTextureArrayLayer(texture, outPage, outLayer))
+		{
+			return true;
+		}
+
+		// Destroyed textures are only looked for once their pages are full.
+		if (ReclaimTextureArrayLayers() > 0 && FindTextureArrayLayer(texture, outPage, outLayer))
+		{
+			return true;
+		}
+
+		if (sData.TextureArrayPages.size() >= kMaxTextureArrayPages)
+		{
+			return false;
+		}
+
+		const auto& specification = texture.GetSpecification();
+		const auto layerCount = static_cast<uint32_t>(std::min<uint64_t>(kTextureArrayPageBytes / texture.GetMemorySize(), kMaxTextureArrayLayers));
+
+		// Layers keep the mips of the textures copied in.
+		TextureSpecification arraySpecification;
+		arraySpecification.Width = specification.Width;
+		arraySpecification.Height = specification.Height;
+		arraySpecification.Format = specification.Format;
+		arraySpecification.GenerateMips = texture.GetMipLevelCount() > 1;
+
+		auto& page = sData.TextureArrayPages.emplace_back();
+		page.Array = Texture2DArray::Create(arraySpecification, layerCount, texture.GetMagFilter());
+
+		outPage = static_cast<uint32_t>(sData.TextureArrayPages.size() - 1);
+		outLayer = page.NextLayer++;
+		return true;
+	}
+
+	// Returns where the texture lives in the texture arrays, copying it there first if needed.
+	// nullptr when it can't be placed, it then takes a Texture2D slot.
+	static const TextureResidency* MakeTextureResident(const Ref<Texture2D>& texture)
+	{
+		const uint32_t rendererID = texture->GetRendererID();
+		auto it = sData.TextureResidencies.find(rendererID);
+		if (it != sData.TextureResidencies.end())
+		{
+			const auto& residency = it->second;
+			// The renderer ID may belong to a new texture, and the filter can be toggled at runtime.
+			if (residency.Texture.lock() == texture && sData.TextureArrayPages[residency.Page].Array->GetMagFilter() == texture->GetMagFilter())
+			{
+				return &residency;
+			}
+
+			sData.TextureArrayPages[residency.Page].FreeLayers.push_back(residency.Layer);
+			sData.TextureResidencies.erase(it);
+		}
+
+		if (!CanUseTextureArray(*texture))
+		{
+			return nullptr;
+		}
+
+		uint32_t page = 0;
+		uint32_t layer = 0;
+		if (!AllocateTextureArrayLayer(*texture, page, layer))
+		{
+			return nullptr;
+		}
+
+		sData.TextureArrayPages[page].Array->CopyToLayer(layer, *texture);
+
+		return &sData.TextureResidencies.emplace(rendererID, TextureResidency{texture, page, layer}).first->second;
+	}
+#pragma endregion
+
+	// Quads and circles are flushed on their own when the sort queue switches between them.
+	static void ResetQuadBatch()
+	{
+		sData.QuadIndexCount = 0;
+		if (sData.Instanced)
+		{
+			sData.QuadInstanceBufferBase = GetBatchBase(sData.QuadInstanceBuffer, sData.QuadInstanceStaging);
+			sData.QuadInstanceBufferPtr = sData.QuadInstanceBufferBase;
+		}
+		else
+		{
+			sData.QuadVertexBufferBase = GetBatchBase(sData.QuadVertexBuffer, sData.QuadVertexStaging);
+			sData.QuadVertexBufferPtr = sData.QuadVertexBufferBase;
+		}
+
+		sData.TextureSlotIndex = 0;
+		sData.TextureArraySlotIndex = 0;
+		sData.ResolvedTextureCount = 0;
+
+		// Invalidates every slot table entry at once, the table is only cleared when the generation wraps.
+		if (++sData.TextureSlotGeneration == 0)
+		{
+			sData.TextureSlotTable.fill({});
+			sData.TextureSlotGeneration = 1;
+		}
+	}
+
+	static void ResetCircleBatch()
+	{
+		sData.CircleIndexCount = 0;
+		if (sData.Instanced)
+		{
+			sData.CircleInstanceBufferBase = GetBatchBase(sData.CircleInstanceBuffer, sData.CircleInstanceStaging);
+			sData.CircleInstanceBufferPtr = sData.CircleInstanceBufferBase;
+		}
+		else
+		{
+			sData.CircleVertexBufferBase = GetBatchBase(sData.CircleVertexBuffer, sData.CircleVertexStaging);
+			sData.CircleVertexBufferPtr = sData.CircleVertexBufferBase;
+		}
+	}
+
+	static void FlushQuadBatch()
+	{
+		if (sData.QuadIndexCount == 0)
+		{
+			return;
+		}
+
+		const auto dataSize = sData.Instanced
+			? static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.QuadInstanceBufferPtr) - reinterpret_cast<uint8_t*>(sData.QuadInstanceBufferBase))
+			: static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.QuadVertexBufferPtr) - reinterpret_cast<uint8_t*>(sData.QuadVertexBufferBase));
+
+		if (sData.Instanced)
+		{
+			if (!sData.QuadInstanceBuffer->IsStreaming())
+			{
+				sData.QuadInstanceBuffer->SetData(sData.QuadInstanceBufferBase, dataSize);
+			}
+		}
+		else if (!sData.QuadVertexBuffer->IsStreaming())
+		{
+			sData.QuadVertexBuffer->SetData(sData.QuadVertexBufferBase, dataSize);
+		}
+
+		// Bind Textures
+		for (uint32_t i = 0; i < sData.TextureSlotIndex; i++)
+		{
+			sData.TextureSlots[i]->Bind(i);
+		}
+
+		for (uint32_t i = 0; i < sData.TextureArraySlotIndex; i++)
+		{
+			sData.TextureArrayPages[sData.TextureArraySlotPages[i]].Array->Bind(Renderer2DData::kTexture2DSlots + i);
+		}
+
+		sData.QuadShader->Bind();
+		if (sData.Instanced)
+		{
+			const uint32_t instanceCount = sData.QuadIndexCount / 6;
+			RenderCommand::DrawInstanced(sData.QuadInstanceVertexArray, Renderer2DData::kQuadVertexCount, instanceCount, sData.QuadInstanceBuffer->GetMappedRegionOffset() / sizeof(QuadInstance));
+			sData.QuadInstanceBuffer->AdvanceRegion(dataSize);
+		}
+		else
+		{
+			RenderCommand::DrawIndexed(sData.QuadVertexArray, sData.QuadIndexCount, sData.QuadVertexBuffer->GetMappedRegionOffset() / sizeof(QuadVertex));
+			sData.QuadVertexBuffer->AdvanceRegion(dataSize);
+		}
+
+		sData.Stats.DrawCalls++;
+	}
+
+	static void FlushCircleBatch()
+	{
+		if (sData.CircleIndexCount == 0)
+		{
+			return;
+		}
+
+		const auto dataSize = sData.Instanced
+			? static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.CircleInstanceBufferPtr) - reinterpret_cast<uint8_t*>(sData.CircleInstanceBufferBase))
+			: static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.CircleVertexBufferPtr) - reinterpret_cast<uint8_t*>(sData.CircleVertexBufferBase));
+
+		if (sData.Instanced)
+		{
+			if (!sData.CircleInstanceBuffer->IsStreaming())
+			{
+				sData.CircleInstanceBuffer->SetData(sData.CircleInstanceBufferBase, dataSize);
+			}
+		}
+		else if (!sData.CircleVertexBuffer->IsStreaming())
+		{
+			sData.CircleVertexBuffer->SetData(sData.CircleVertexBufferBase, dataSize);
+		}
+
+		sData.CircleShader->Bind();
+		if (sData.Instanced)
+		{
+			const uint32_t instanceCount = sData.CircleIndexCount / 6;
+			RenderCommand::DrawInstanced(sData.CircleInstanceVertexArray, Renderer2DData::kQuadVertexCount, instanceCount, sData.CircleInstanceBuffer->GetMappedRegionOffset() / sizeof(CircleInstance));
+			sData.CircleInstanceBuffer->AdvanceRegion(dataSize);
+		}
+		else
+		{
+			RenderCommand::DrawIndexed(sData.CircleVertexArray, sData.CircleIndexCount, sData.CircleVertexBuffer->GetMappedRegionOffset() / sizeof(CircleVertex));
+			sData.CircleVertexBuffer->AdvanceRegion(dataSize);
+		}
+
+		sData.Stats.DrawCalls++;
+	}
+
+	static void DrawStaticChunk(const Renderer2D::StaticBatch::Chunk& chunk)
+	{
+		for (uint32_t i = 0; i < chunk.Textures.size(); i++)
+		{
+			chunk.Textures[i]->Bind(i);
+		}
+
+		sData.QuadShader->Bind();
+		if (sData.Instanced)
+		{
+			RenderCommand::DrawInstanced(chunk.Vertices, Renderer2DData::kQuadVertexCount, chunk.QuadCount);
+		}
+		else
+		{
+			RenderCommand::DrawIndexed(chunk.Vertices, chunk.QuadCount * 6);
+		}
+
+		sData.Stats.DrawCalls++;
+		sData.Stats.StaticQuadCount += chunk.QuadCount;
+	}
+
+	void Renderer2D::Init(bool instanced)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		sData.Instanced = instanced;
+
+#pragma region Quad
 		auto* quadIndices = new uint32_t[Renderer2DData::MaxIndices];
 
 		uint32_t offset = 0;
@@ -164,36 +1013,94 @@ namespace Hazel
 			quadIndices[i + 4] = offset + 3;
 			quadIndices[i + 5] = offset + 0;
 
-			offset += 4;
-		}
+			offset += 4;
+		}
+
+		// Text always uses it, quads and circles only when they are not instanced.
+		sData.QuadIndexBuffer = IndexBuffer::Create(quadIndices, Renderer2DData::MaxIndices);
+		delete[] quadIndices;
+
+		if (!sData.Instanced)
+		{
+			sData.QuadVertexArray = VertexArray::Create();
+
+			sData.QuadVertexBuffer = VertexBuffer::CreateStreaming(Renderer2DData::MaxVertices * sizeof(QuadVertex), Renderer2DData::kStreamingBatchesPerFrame, Renderer2DData::kStreamingFrameCount);
+			sData.QuadVertexBuffer->SetLayout(GetQuadVertexLayout());
+			sData.QuadVertexArray->AddVertexBuffer(sData.QuadVertexBuffer);
+			sData.QuadVertexArray->SetIndexBuffer(sData.QuadIndexBuffer);
+
+			if (!sData.QuadVertexBuffer->IsStreaming())
+			{
+				sData.QuadVertexStaging = new QuadVertex[Renderer2DData::MaxVertices];
+			}
+		}
+#pragma endregion
+
+#pragma region Circle
+		if (!sData.Instanced)
+		{
+			sData.CircleVertexArray = VertexArray::Create();
+
+			sData.CircleVertexBuffer = VertexBuffer::CreateStreaming(Renderer2DData::MaxVertices * sizeof(CircleVertex), Renderer2DData::kStreamingBatchesPerFrame, Renderer2DData::kStreamingFrameCount);
+			sData.CircleVertexBuffer->SetLayout(
+				{
+					{ ShaderDataType::Float3, "a_WorldPosition"	},
+					{ ShaderDataType::Float3, "a_LocalPosition"	},
+					{ ShaderDataType::Float4, "a_Color"		},
+					{ ShaderDataType::Float,  "a_Thickness"	},
+					{ ShaderDataType::Float,  "a_Float"		},
+					{ ShaderDataType::Int,	  "a_EntityID"	},
+				});
+			sData.CircleVertexArray->AddVertexBuffer(sData.CircleVertexBuffer);
+			sData.CircleVertexArray->SetIndexBuffer(sData.QuadIndexBuffer); // Use Quad Index Buffer
+			if (!sData.CircleVertexBuffer->IsStreaming())
+			{
+				sData.CircleVertexStaging = new CircleVertex[Renderer2DData::MaxVertices];
+			}
+		}
+#pragma endregion
+
+#pragma region Instanced
+		if (sData.Instanced)
+		{
+			static_assert(sizeof(QuadInstance) == 64, "QuadInstance layout changed, update the instance buffer layout.");
+			static_assert(sizeof(CircleInstance) == 52, "CircleInstance layout changed, update the instance buffer layout.");
+
+			sData.QuadInstanceVertexArray = VertexArray::Create();
 
-		const auto quadIndexBuffer = IndexBuffer::Create(quadIndices, Renderer2DData::MaxIndices);
-		sData.QuadVertexArray->SetIndexBuffer(quadIndexBuffer);
-		delete[] quadIndices;
-#pragma endregion
+			sData.QuadInstanceBuffer = VertexBuffer::CreateStreaming(Renderer2DData::MaxQuads * sizeof(QuadInstance), Renderer2DData::kStreamingBatchesPerFrame, Renderer2DData::kStreamingFrameCount);
+			sData.QuadInstanceBuffer->SetLayout(GetQuadInstanceLayout());
+			sData.QuadInstanceVertexArray->AddVertexBuffer(sData.QuadInstanceBuffer);
+			if (!sData.QuadInstanceBuffer->IsStreaming())
+			{
+				sData.QuadInstanceStaging = new QuadInstance[Renderer2DData::MaxQuads];
+			}
 
-#pragma region Circle
-		sData.CircleVertexArray = VertexArray::Create();
+			sData.CircleInstanceVertexArray = VertexArray::Create();
 
-		sData.CircleVertexBuffer = VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(CircleVertex));
-		sData.CircleVertexBuffer->SetLayout(
+			sData.CircleInstanceBuffer = VertexBuffer::CreateStreaming(Renderer2DData::MaxQuads * sizeof(CircleInstance), Renderer2DData::kStreamingBatchesPerFrame, Renderer2DData::kStreamingFrameCount);
+			sData.CircleInstanceBuffer->SetLayout(BufferLayout(
+				{
+					{ ShaderDataType::Float3, "a_AxisX"		},
+					{ ShaderDataType::Float3, "a_AxisY"		},
+					{ ShaderDataType::Float3, "a_Center"	},
+					{ ShaderDataType::Int,	  "a_Color"		},
+					{ ShaderDataType::Float,  "a_Thickness"	},
+					{ ShaderDataType::Float,  "a_Fade"		},
+					{ ShaderDataType::Int,	  "a_EntityID"	},
+				}, true));
+			sData.CircleInstanceVertexArray->AddVertexBuffer(sData.CircleInstanceBuffer);
+			if (!sData.CircleInstanceBuffer->IsStreaming())
 			{
-				{ ShaderDataType::Float3, "a_WorldPosition"	},
-				{ ShaderDataType::Float3, "a_LocalPosition"	},
-				{ ShaderDataType::Float4, "a_Color"		},
-				{ ShaderDataType::Float,  "a_Thickness"	},
-				{ ShaderDataType::Float,  "a_Float"		},
-				{ ShaderDataType::Int,	  "a_EntityID"	},
-			});
-		sData.CircleVertexArray->AddVertexBuffer(sData.CircleVertexBuffer);
-		sData.CircleVertexArray->SetIndexBuffer(quadIndexBuffer); // Use Quad Index Buffer
-		sData.CircleVertexBufferBase = new CircleVertex[Renderer2DData::MaxVertices];
+				sData.CircleInstanceStaging = new CircleInstance[Renderer2DData::MaxQuads];
+			}
+		}
 #pragma endregion
 
 #pragma region Line
 		sData.LineVertexArray = VertexArray::Create();
 
-		sData.LineVertexBuffer = VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(LineVertex));
+		sData.LineVertexBuffer = VertexBuffer::CreateStreaming(Renderer2DData::MaxVertices * sizeof(LineVertex), Renderer2DData::kStreamingBatchesPerFrame, Renderer2DData::kStreamingFrameCount);
 		sData.LineVertexBuffer->SetLayout(
 			{
 				{ ShaderDataType::Float3, "a_Position"	},
@@ -201,13 +1108,16 @@ namespace Hazel
 				{ ShaderDataType::Int,	  "a_EntityID"	},
 			});
 		sData.LineVertexArray->AddVertexBuffer(sData.LineVertexBuffer);
-		sData.LineVertexBufferBase = new LineVertex[Renderer2DData::MaxVertices];
+		if (!sData.LineVertexBuffer->IsStreaming())
+		{
+			sData.LineVertexStaging = new LineVertex[Renderer2DData::MaxVertices];
+		}
 #pragma endregion
 
 #pragma region Text
 		sData.TextVertexArray = VertexArray::Create();
 
-		sData.TextVertexBuffer = VertexBuffer::Create(Renderer2DData::MaxVertices * sizeof(TextVertex));
+		sData.TextVertexBuffer = VertexBuffer::CreateStreaming(Renderer2DData::MaxVertices * sizeof(TextVertex), Renderer2DData::kStreamingBatchesPerFrame, Renderer2DData::kStreamingFrameCount);
 		sData.TextVertexBuffer->SetLayout(
 			{
 				{ShaderDataType::Float3, "a_Position"		},
@@ -216,8 +1126,11 @@ namespace Hazel
 				{ShaderDataType::Int,	 "a_EntityID"		},
 			});
 		sData.TextVertexArray->AddVertexBuffer(sData.TextVertexBuffer);
-		sData.TextVertexBufferBase = new TextVertex[Renderer2DData::MaxVertices];
-		sData.TextVertexArray->SetIndexBuffer(quadIndexBuffer); // Use Quad Index Buffer
+		if (!sData.TextVertexBuffer->IsStreaming())
+		{
+			sData.TextVertexStaging = new TextVertex[Renderer2DData::MaxVertices];
+		}
+		sData.TextVertexArray->SetIndexBuffer(sData.QuadIndexBuffer); // Use Quad Index Buffer
 #pragma endregion
 
 		// -- Shader loading
@@ -226,8 +1139,8 @@ namespace Hazel
 #if ASYNC
 		LoadShadersAsync();
 #else
-		sData.QuadShader = Shader::Create(SHADER_PATH_QUAD);
-		sData.CircleShader = Shader::Create(SHADER_PATH_CIRCLE);
+		sData.QuadShader = Shader::Create(GetQuadShaderPath());
+		sData.CircleShader = Shader::Create(GetCircleShaderPath());
 		sData.LineShader = Shader::Create(SHADER_PATH_LINE);
 		sData.TextShader = Shader::Create(SHADER_PATH_TEXT);
 #endif // ASYNC
@@ -247,8 +1160,18 @@ namespace Hazel
 		HZ_PROFILE_FUNCTION();
 
 		sAsyncShaderCreation.get();
-		delete[] sData.QuadVertexBufferBase;
+		delete[] sData.QuadVertexStaging;
+		delete[] sData.CircleVertexStaging;
+		delete[] sData.LineVertexStaging;
+		delete[] sData.TextVertexStaging;
+		delete[] sData.QuadInstanceStaging;
+		delete[] sData.CircleInstanceStaging;
 		delete[] sData.QuadTextureCoordinates;
+
+		sData.TextureResidencies.clear();
+		sData.TextureArrayPages.clear();
+		sData.SpriteTextures.clear();
+		sData.LastSpriteTexture = nullptr;
 	}
 
 	bool Renderer2D::BeginScene(const Camera& camera, const glm::mat4& transform)
@@ -309,6 +1232,9 @@ namespace Hazel
 		sData.CameraUniformBuffer->SetData(&sData.CameraBuffer, sizeof(Renderer2DData::CameraData));
 		Reset();
 
+		sData.QueuedDraws.clear();
+		sData.QueuedDrawKeys.clear();
+
 		return true;
 	}
 
@@ -316,81 +1242,66 @@ namespace Hazel
 	{
 		HZ_PROFILE_FUNCTION();
 
+		SubmitQueue();
 		Flush();
 	}
 
-	void Renderer2D::Reset()
+	void Renderer2D::EndFrame()
 	{
 		HZ_PROFILE_FUNCTION();
 
-#pragma region Quad
-		sData.QuadIndexCount = 0;
-		sData.QuadVertexBufferPtr = sData.QuadVertexBufferBase;
-#pragma endregion
+		for (const Ref<VertexBuffer>& vertexBuffer : { sData.QuadVertexBuffer, sData.CircleVertexBuffer, sData.QuadInstanceBuffer, sData.CircleInstanceBuffer, sData.LineVertexBuffer, sData.TextVertexBuffer })
+		{
+			if (vertexBuffer)
+			{
+				vertexBuffer->EndFrame();
+			}
+		}
 
-#pragma region Circle
-		sData.CircleIndexCount = 0;
-		sData.CircleVertexBufferPtr = sData.CircleVertexBufferBase;
-#pragma endregion
+		sData.SpriteTextures.clear();
+		sData.LastSpriteTexture = nullptr;
+	}
+
+	void Renderer2D::Reset()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		ResetQuadBatch();
+		ResetCircleBatch();
 
 #pragma region Line
 		sData.LineVertexCount = 0;
+		sData.LineVertexBufferBase = GetBatchBase(sData.LineVertexBuffer, sData.LineVertexStaging);
 		sData.LineVertexBufferPtr = sData.LineVertexBufferBase;
 #pragma endregion
 
 #pragma region Text
 		sData.TextIndexCount = 0;
+		sData.TextVertexBufferBase = GetBatchBase(sData.TextVertexBuffer, sData.TextVertexStaging);
 		sData.TextVertexBufferPtr = sData.TextVertexBufferBase;
 #pragma endregion
-
-		sData.TextureSlotIndex = 0;
 	}
 
 	void Renderer2D::Flush()
 	{
 		HZ_PROFILE_FUNCTION();
 
-#pragma region Quad
-		if (sData.QuadIndexCount > 0)
-		{
-			auto dataSize = static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.QuadVertexBufferPtr) - reinterpret_cast<uint8_t*>(sData.QuadVertexBufferBase));
-			sData.QuadVertexBuffer->SetData(sData.QuadVertexBufferBase, dataSize);
-
-			// Bind Textures
-			for (uint32_t i = 0; i < sData.TextureSlotIndex; i++)
-			{
-				sData.TextureSlots[i]->Bind(i);
-			}
-
-			sData.QuadShader->Bind();
-			RenderCommand::DrawIndexed(sData.QuadVertexArray, sData.QuadIndexCount);
-
-			sData.Stats.DrawCalls++;
-		}
-#pragma endregion
-
-#pragma region Circle
-		if (sData.CircleIndexCount > 0)
-		{
-			auto dataSize = static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.CircleVertexBufferPtr) - reinterpret_cast<uint8_t*>(sData.CircleVertexBufferBase));
-			sData.CircleVertexBuffer->SetData(sData.CircleVertexBufferBase, dataSize);
-
-			sData.CircleShader->Bind();
-			RenderCommand::DrawIndexed(sData.CircleVertexArray, sData.CircleIndexCount);
-
-			sData.Stats.DrawCalls++;
-		}
-#pragma endregion
+		FlushQuadBatch();
+		FlushCircleBatch();
 
 #pragma region Line
 		if (sData.LineVertexCount > 0)
 		{
 			const auto dataSize = static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.LineVertexBufferPtr) - reinterpret_cast<uint8_t*>(sData.LineVertexBufferBase));
-			sData.LineVertexBuffer->SetData(sData.LineVertexBufferBase, dataSize);
+			if (!sData.LineVertexBuffer->IsStreaming())
+			{
+				sData.LineVertexBuffer->SetData(sData.LineVertexBufferBase, dataSize);
+			}
 
 			sData.LineShader->Bind();
 			RenderCommand::SetLineWidth(sData.LineWidth);
-			RenderCommand::DrawLines(sData.LineVertexArray, sData.LineVertexCount);
+			RenderCommand::DrawLines(sData.LineVertexArray, sData.LineVertexCount, sData.LineVertexBuffer->GetMappedRegionOffset() / sizeof(LineVertex));
+			sData.LineVertexBuffer->AdvanceRegion(dataSize);
 
 			sData.Stats.DrawCalls++;
 		}
@@ -400,12 +1311,16 @@ namespace Hazel
 		if (sData.TextIndexCount > 0)
 		{
 			const auto dataSize = static_cast<uint32_t>(reinterpret_cast<uint8_t*>(sData.TextVertexBufferPtr) - reinterpret_cast<uint8_t*>(sData.TextVertexBufferBase));
-			sData.TextVertexBuffer->SetData(sData.TextVertexBufferBase, dataSize);
+			if (!sData.TextVertexBuffer->IsStreaming())
+			{
+				sData.TextVertexBuffer->SetData(sData.TextVertexBufferBase, dataSize);
+			}
 
 			sData.FontAtlasTexture->Bind();
 
 			sData.TextShader->Bind();
-			RenderCommand::DrawIndexed(sData.TextVertexArray, sData.TextIndexCount);
+			RenderCommand::DrawIndexed(sData.TextVertexArray, sData.TextIndexCount, sData.TextVertexBuffer->GetMappedRegionOffset() / sizeof(TextVertex));
+			sData.TextVertexBuffer->AdvanceRegion(dataSize);
 
 			sData.Stats.DrawCalls++;
 		}
@@ -448,7 +1363,7 @@ namespace Hazel
 	{
 		HZ_PROFILE_FUNCTION();
 
-		UpdateQuadData(transform, color, entityID);
+		QueueQuad(transform, color, nullptr, kFullUVRect, glm::vec2(1.0f), entityID, 0);
 	}
 #pragma endregion
 
@@ -494,37 +1409,7 @@ namespace Hazel
 			return;
 		}
 
-		int textureIndex = 0;
-
-		// Check if the texture already was assigned to a texture slot.
-		for (uint32_t i = 0; i < sData.TextureSlotIndex; i++)
-		{
-			if (sData.TextureSlots[i]->Equals(*texture))
-			{
-				textureIndex = i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0)
-		{
-			// If all slots are taken, flush and reset.
-			if (sData.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-			{
-				FlushAndReset();
-			}
-
-			textureIndex = sData.TextureSlotIndex;
-			sData.TextureSlots[sData.TextureSlotIndex] = texture;
-			sData.TextureSlotIndex++;
-		}
-
-		sData.QuadTextureCoordinates[0] = {0.0f, 0.0f};
-		sData.QuadTextureCoordinates[1] = {1.0f, 0.0f};
-		sData.QuadTextureCoordinates[2] = {1.0f, 1.0f};
-		sData.QuadTextureCoordinates[3] = {0.0f, 1.0f};
-
-		UpdateQuadData(transform, tintColor, entityID, tilingFactor, textureIndex);
+		QueueQuad(transform, tintColor, texture, kFullUVRect, tilingFactor, entityID, 0);
 	}
 #pragma endregion
 
@@ -570,58 +1455,153 @@ namespace Hazel
 			return;
 		}
 
-		auto coords = subTexture->GetTexCoords();
-		auto newCoords = new glm::vec2[4];
-		for (int i = 0; i < 4; i++)
+		const auto* coords = subTexture->GetTexCoords();
+		const glm::vec4 uvRect = {coords[0].x, coords[0].y, coords[2].x, coords[2].y};
+
+		QueueQuad(transform, tintColor, subTexture->GetTexture(), uvRect, tilingFactor, -1, 0);
+	}
+#pragma endregion
+
+#pragma region Batched Quads
+	void Renderer2D::DrawQuads(const glm::mat4* transforms, const Color* colors, uint32_t count, const int* entityIDs, int layer)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		QueueQuads(transforms, colors, count, nullptr, nullptr, glm::vec2(1.0f), entityIDs, layer);
+	}
+
+	void Renderer2D::DrawQuads(const glm::mat4* transforms, const Color* colors, uint32_t count, const Ref<Texture2D>& texture, const glm::vec4* uvRects, const glm::vec2& tilingFactor, const int* entityIDs, int layer)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (texture == nullptr)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				DrawInvalidTexture(transforms[i]);
+			}
+			return;
+		}
+
+		QueueQuads(transforms, colors, count, texture, uvRects, tilingFactor, entityIDs, layer);
+	}
+#pragma endregion
+
+	void Renderer2D::DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& spriteRenderComponent, int entityID, int layer)
+	{
+		QueueQuad(transform, spriteRenderComponent.Color, GetSpriteTexture(spriteRenderComponent.TextureHandle), kFullUVRect, spriteRenderComponent.Tiling, entityID, layer);
+	}
+
+#pragma region Static Quads
+	Ref<Renderer2D::StaticBatch> Renderer2D::CreateStaticBatch(const std::vector<StaticQuad>& quads)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		// Back to front, the quads of a chunk are drawn in this order.
+		std::vector<uint32_t> order(quads.size());
+		for (uint32_t i = 0; i < order.size(); i++)
 		{
-			newCoords[i] = coords[i];
+			order[i] = i;
 		}
-		sData.QuadTextureCoordinates = newCoords;
+		std::stable_sort(order.begin(), order.end(), [&quads](uint32_t a, uint32_t b)
+		{
+			return quads[a].Transform[3].z < quads[b].Transform[3].z;
+		});
 
-		int textureIndex = 0;
+		auto batch = CreateRef<StaticBatch>();
 
-		// Check if the texture already was assigned to a texture slot.
-		for (uint32_t i = 0; i < sData.TextureSlotIndex; i++)
+		std::vector<QuadVertex> vertices;
+		std::vector<QuadInstance> instances;
+		auto buildChunk = [&](StaticBatch::Chunk& chunk, glm::vec3 positionSum)
 		{
-			if (sData.TextureSlots[i]->Equals(*subTexture->GetTexture()))
+			chunk.Center = positionSum / static_cast<float>(chunk.QuadCount);
+			chunk.Vertices = VertexArray::Create();
+
+			Ref<VertexBuffer> vertexBuffer;
+			if (sData.Instanced)
 			{
-				textureIndex = i;
-				break;
+				vertexBuffer = VertexBuffer::Create(reinterpret_cast<float*>(instances.data()), static_cast<uint32_t>(instances.size() * sizeof(QuadInstance)));
+				vertexBuffer->SetLayout(GetQuadInstanceLayout());
 			}
-		}
+			else
+			{
+				vertexBuffer = VertexBuffer::Create(reinterpret_cast<float*>(vertices.data()), static_cast<uint32_t>(vertices.size() * sizeof(QuadVertex)));
+				vertexBuffer->SetLayout(GetQuadVertexLayout());
+				chunk.Vertices->SetIndexBuffer(sData.QuadIndexBuffer);
+			}
+			chunk.Vertices->AddVertexBuffer(vertexBuffer);
+
+			vertices.clear();
+			instances.clear();
+		};
 
-		if (textureIndex == 0)
+		StaticBatch::Chunk chunk;
+		glm::vec3 positionSum{0.0f};
+		for (const uint32_t index : order)
 		{
-			// If all slots are taken, flush and reset.
-			if (sData.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
+			const StaticQuad& quad = quads[index];
+
+			int textureIndex = -1;
+			if (quad.Texture)
 			{
-				FlushAndReset();
+				const auto it = std::find(chunk.Textures.begin(), chunk.Textures.end(), quad.Texture);
+				textureIndex = static_cast<int>(it - chunk.Textures.begin());
+			}
+
+			// Start a new chunk once every texture slot is taken or the index buffer is exhausted.
+			const bool needsSlot = quad.Texture && textureIndex == static_cast<int>(chunk.Textures.size());
+			if (chunk.QuadCount == Renderer2DData::MaxQuads || (needsSlot && chunk.Textures.size() == Renderer2DData::kTexture2DSlots))
+			{
+				buildChunk(chunk, positionSum);
+				batch->Chunks.push_back(std::move(chunk));
+				chunk = {};
+				positionSum = glm::vec3(0.0f);
+				textureIndex = quad.Texture ? 0 : -1;
+			}
+
+			if (quad.Texture && textureIndex == static_cast<int>(chunk.Textures.size()))
+			{
+				chunk.Textures.push_back(quad.Texture);
+			}
+
+			if (sData.Instanced)
+			{
+				instances.emplace_back();
+				WriteQuadInstance(&instances.back(), quad.Transform, quad.Color, kFullUVRect, textureIndex, quad.TilingFactor, quad.EntityID);
 			}
+			else
+			{
+				const glm::vec2 textureCoordinates[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+				vertices.resize(vertices.size() + Renderer2DData::kQuadVertexCount);
+				WriteQuadVertices(&vertices[vertices.size() - Renderer2DData::kQuadVertexCount], quad.Transform, quad.Color, textureCoordinates, textureIndex, quad.TilingFactor, quad.EntityID);
+			}
+
+			chunk.IsTranslucent |= IsTranslucent(quad.Color, quad.Texture);
+			chunk.QuadCount++;
+			positionSum += glm::vec3(quad.Transform[3]);
+		}
 
-			textureIndex = sData.TextureSlotIndex;
-			sData.TextureSlots[sData.TextureSlotIndex] = subTexture->GetTexture();
-			sData.TextureSlotIndex++;
+		if (chunk.QuadCount > 0)
+		{
+			buildChunk(chunk, positionSum);
+			batch->Chunks.push_back(std::move(chunk));
 		}
 
-		UpdateQuadData(transform, tintColor, -1, tilingFactor, textureIndex);
+		return batch;
 	}
-#pragma endregion
 
-	void Renderer2D::DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& spriteRenderComponent, int entityID)
+	void Renderer2D::DrawStaticBatch(const Ref<StaticBatch>& batch, int layer)
 	{
-		if (spriteRenderComponent.Texture != nullptr)
-		{
-			DrawQuad(transform, spriteRenderComponent.Texture, spriteRenderComponent.Tiling, spriteRenderComponent.Color, entityID);
-		}
-		else
+		for (const auto& chunk : batch->Chunks)
 		{
-			DrawQuad(transform, spriteRenderComponent.Color, entityID);
+			QueueStaticChunk(chunk, layer);
 		}
 	}
+#pragma endregion
 
-	void Renderer2D::DrawCircle(const glm::mat4& transform, const Color& color, float thickness, float fade, int entityID)
+	void Renderer2D::DrawCircle(const glm::mat4& transform, const Color& color, float thickness, float fade, int entityID, int layer)
 	{
-		UpdateCircleData(transform, color, entityID, thickness, fade);
+		QueueCircle(transform, color, thickness, fade, entityID, layer);
 	}
 
 #pragma region Lines
@@ -656,11 +1636,7 @@ namespace Hazel
 	void Renderer2D::DrawRect(const glm::mat4& transform, const Color& color, int entityID)
 	{
 		glm::vec3 lineVertices[4];
-
-		for (size_t i = 0; i < 4; i++)
-		{
-			lineVertices[i] = transform * sData.QuadVertexPositions[i];
-		}
+		ComputeQuadCorners(transform, lineVertices);
 
 		DrawLine(lineVertices[0], lineVertices[1], color);
 		DrawLine(lineVertices[1], lineVertices[2], color);
@@ -669,6 +1645,26 @@ namespace Hazel
 	}
 #pragma endregion
 
+	bool Renderer2D::IsInstanced()
+	{
+		return sData.Instanced;
+	}
+
+	void Renderer2D::SetTextureArraysEnabled(bool enabled)
+	{
+		sData.TextureArraysEnabled = enabled;
+		if (!enabled)
+		{
+			sData.TextureResidencies.clear();
+			sData.TextureArrayPages.clear();
+		}
+	}
+
+	bool Renderer2D::AreTextureArraysEnabled()
+	{
+		return sData.TextureArraysEnabled;
+	}
+
 	float Renderer2D::GetLineWidth()
 	{
 		return sData.LineWidth;
@@ -696,6 +1692,7 @@ namespace Hazel
 
 		if (sData.FontAtlasTexture && sData.FontAtlasTexture != fontAtlas)
 		{
+			sData.Stats.FontAtlasFlushes++;
 			FlushAndReset();
 		}
 
@@ -759,6 +1756,7 @@ namespace Hazel
 			// render here
 			if (sData.TextIndexCount >= Renderer2DData::MaxIndices)
 			{
+				sData.Stats.CapacityFlushes++;
 				FlushAndReset();
 			}
 
@@ -807,7 +1805,50 @@ namespace Hazel
 
 	Renderer2D::Statistics Renderer2D::GetStats()
 	{
-		return sData.Stats;
+		Statistics stats = sData.Stats;
+		stats.TextureArrayPages = static_cast<uint32_t>(sData.TextureArrayPages.size());
+		stats.ResidentTextures = static_cast<uint32_t>(sData.TextureResidencies.size());
+		return stats;
+	}
+
+	Renderer2D::QuadKernelBenchmark Renderer2D::BenchmarkQuadKernels(uint32_t quadCount, uint32_t iterations)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::vector<glm::mat4> transforms(quadCount);
+		for (uint32_t i = 0; i < quadCount; i++)
+		{
+			const auto value = static_cast<float>(i);
+			transforms[i] = glm::translate(_sIdentityMatrix, {value * 0.01f, value * -0.02f, value * 0.001f})
+				* glm::rotate(_sIdentityMatrix, value, {0.0f, 0.0f, 1.0f})
+				* glm::scale(_sIdentityMatrix, {1.0f + value * 0.001f, 2.0f, 1.0f});
+		}
+
+		std::vector<QuadVertex> vertices(static_cast<size_t>(quadCount) * Renderer2DData::kQuadVertexCount);
+		constexpr glm::vec2 textureCoordinates[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+
+		auto measure = [&](auto writeQuadVertices)
+		{
+			return Timer::MeasureFastestMillis(iterations, [&]()
+			{
+				QuadVertex* vertex = vertices.data();
+				for (const auto& transform : transforms)
+				{
+					writeQuadVertices(vertex, transform, Color::White, textureCoordinates, 0, glm::vec2(1.0f), -1);
+					vertex += Renderer2DData::kQuadVertexCount;
+				}
+			});
+		};
+
+		QuadKernelBenchmark result;
+		result.QuadCount = quadCount;
+		result.ReferenceMillis = measure(WriteQuadVerticesReference);
+		result.ScalarMillis = measure(WriteQuadVerticesScalar);
+		result.SIMDMillis = measure(WriteQuadVertices);
+
+		HZ_CORE_LINFO("Quad kernels for {0} quads: Reference {1}ms, Scalar {2}ms, SIMD {3}ms", quadCount, result.ReferenceMillis, result.ScalarMillis, result.SIMDMillis);
+
+		return result;
 	}
 
 	bool Renderer2D::IsReady()
@@ -831,14 +1872,14 @@ namespace Hazel
 			sData.QuadShader = nullptr;
 			sAsyncShaderCreation = std::async(std::launch::async, []()
 			{
-				sData.QuadShader = Shader::Create(SHADER_PATH_QUAD, true);
+				sData.QuadShader = Shader::Create(GetQuadShaderPath(), true);
 			});
 			break;
 		case Hazel::CIRCLE:
 			sData.CircleShader = nullptr;
 			sAsyncShaderCreation = std::async(std::launch::async, []()
 			{
-				sData.CircleShader = Shader::Create(SHADER_PATH_CIRCLE, true);
+				sData.CircleShader = Shader::Create(GetCircleShaderPath(), true);
 			});
 			break;
 		case Hazel::LINE:
@@ -870,8 +1911,8 @@ namespace Hazel
 
 		sAsyncShaderCreation = std::async(std::launch::async, []
 		{
-			sData.QuadShader = Shader::Create(SHADER_PATH_QUAD);
-			sData.CircleShader = Shader::Create(SHADER_PATH_CIRCLE);
+			sData.QuadShader = Shader::Create(GetQuadShaderPath());
+			sData.CircleShader = Shader::Create(GetCircleShaderPath());
 			sData.LineShader = Shader::Create(SHADER_PATH_LINE);
 			sData.TextShader = Shader::Create(SHADER_PATH_TEXT);
 		});
@@ -881,28 +1922,192 @@ namespace Hazel
 	{
 		HZ_PROFILE_FUNCTION();
 
-		EndScene();
+		// Not EndScene, this is also called while the queue is being submitted.
+		Flush();
 		Reset();
 	}
 
+	void Renderer2D::SubmitQueue()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		auto& keys = sData.QueuedDrawKeys;
+		RadixSort(keys, sData.QueuedDrawKeysScratch);
+
+		for (const auto& entry : keys)
+		{
+			const QueuedDraw& draw = sData.QueuedDraws[entry.Index];
+			if (draw.Primitive == QueuedPrimitive::StaticChunk)
+			{
+				// Drawn from its own buffers, everything batched so far goes first.
+				if (sData.QuadIndexCount > 0 || sData.CircleIndexCount > 0)
+				{
+					sData.Stats.OrderFlushes++;
+					FlushQuadBatch();
+					ResetQuadBatch();
+					FlushCircleBatch();
+					ResetCircleBatch();
+				}
+
+				DrawStaticChunk(*draw.StaticChunk);
+				continue;
+			}
+
+			if (draw.Primitive == QueuedPrimitive::Circle)
+			{
+				// Quads and circles have their own batch, draw the quads so far first to keep the sorted order.
+				if (sData.QuadIndexCount > 0)
+				{
+					sData.Stats.OrderFlushes++;
+					FlushQuadBatch();
+					ResetQuadBatch();
+				}
+
+				UpdateCircleData(draw.Transform, draw.Color, draw.EntityID, draw.Thickness, draw.Fade);
+				continue;
+			}
+
+			if (sData.CircleIndexCount > 0)
+			{
+				sData.Stats.OrderFlushes++;
+				FlushCircleBatch();
+				ResetCircleBatch();
+			}
+
+			// Flush for capacity before resolving the slot, flushing afterwards would release it.
+			if (sData.QuadIndexCount >= Renderer2DData::MaxIndices)
+			{
+				sData.Stats.CapacityFlushes++;
+				FlushAndReset();
+			}
+
+			const int textureIndex = draw.Texture ? GetTextureIndex(draw.Texture) : -1;
+
+			sData.QuadTextureCoordinates[0] = {draw.UVRect.x, draw.UVRect.y};
+			sData.QuadTextureCoordinates[1] = {draw.UVRect.z, draw.UVRect.y};
+			sData.QuadTextureCoordinates[2] = {draw.UVRect.z, draw.UVRect.w};
+			sData.QuadTextureCoordinates[3] = {draw.UVRect.x, draw.UVRect.w};
+
+			UpdateQuadData(draw.Transform, draw.Color, draw.EntityID, draw.TilingFactor, textureIndex);
+		}
+
+		sData.QueuedDraws.clear();
+		keys.clear();
+	}
+
+	int Renderer2D::GetTextureIndex(const Ref<Texture2D>& texture)
+	{
+		constexpr uint32_t tableMask = Renderer2DData::kTextureSlotTableSize - 1;
+
+		const uint32_t rendererID = texture->GetRendererID();
+		const uint32_t homeIndex = (rendererID * 2654435761u) >> (32 - Renderer2DData::kTextureSlotTableBits);
+
+		// Check if the texture already was resolved in this batch.
+		uint32_t tableIndex = homeIndex;
+		while (sData.TextureSlotTable[tableIndex].Generation == sData.TextureSlotGeneration)
+		{
+			const auto& entry = sData.TextureSlotTable[tableIndex];
+			if (entry.RendererID == rendererID)
+			{
+				return entry.Index;
+			}
+
+			tableIndex = (tableIndex + 1) & tableMask;
+		}
+
+		// Flushing and resetting invalidates the whole table.
+		if (sData.ResolvedTextureCount >= Renderer2DData::kMaxResolvedTextures)
+		{
+			sData.Stats.TextureSlotFlushes++;
+			FlushAndReset();
+			tableIndex = homeIndex;
+		}
+
+		int textureIndex = -1;
+		if (sData.TextureArraysEnabled)
+		{
+			const uint32_t generation = sData.TextureSlotGeneration;
+			textureIndex = GetTextureArrayIndex(texture);
+			if (sData.TextureSlotGeneration != generation)
+			{
+				tableIndex = homeIndex;
+			}
+		}
+
+		if (textureIndex < 0)
+		{
+			// If all slots are taken, flush and reset.
+			if (sData.TextureSlotIndex >= Renderer2DData::kTexture2DSlots)
+			{
+				sData.Stats.TextureSlotFlushes++;
+				FlushAndReset();
+				tableIndex = homeIndex;
+			}
+
+			const uint32_t slot = sData.TextureSlotIndex++;
+			sData.TextureSlots[slot] = texture;
+			textureIndex = static_cast<int>(slot);
+		}
+
+		sData.TextureSlotTable[tableIndex] = {rendererID, textureIndex, sData.TextureSlotGeneration};
+		sData.ResolvedTextureCount++;
+
+		return textureIndex;
+	}
+
+	int Renderer2D::GetTextureArrayIndex(const Ref<Texture2D>& texture)
+	{
+		const TextureResidency* residency = MakeTextureResident(texture);
+		if (residency == nullptr)
+		{
+			return -1;
+		}
+
+		const uint32_t page = residency->Page;
+		const uint32_t layer = residency->Layer;
+
+		uint32_t arraySlot = 0;
+		while (arraySlot < sData.TextureArraySlotIndex && sData.TextureArraySlotPages[arraySlot] != page)
+		{
+			arraySlot++;
+		}
+
+		if (arraySlot == sData.TextureArraySlotIndex)
+		{
+			// If all array slots are taken, flush and reset.
+			if (sData.TextureArraySlotIndex >= Renderer2DData::kTextureArraySlots)
+			{
+				sData.Stats.TextureSlotFlushes++;
+				FlushAndReset();
+			}
+
+			arraySlot = sData.TextureArraySlotIndex++;
+			sData.TextureArraySlotPages[arraySlot] = page;
+		}
+
+		return kTextureArrayIndexFlag | static_cast<int>(arraySlot << kTextureArraySlotShift) | static_cast<int>(layer);
+	}
+
 	void Renderer2D::UpdateQuadData(const glm::mat4& transform, const Color& color, int entityID, const glm::vec2& tilingFactor, int textureIndex)
 	{
 		HZ_PROFILE_FUNCTION();
 
 		if (sData.QuadIndexCount >= Renderer2DData::MaxIndices)
 		{
+			sData.Stats.CapacityFlushes++;
 			FlushAndReset();
 		}
 
-		for (uint32_t i = 0; i < Renderer2DData::kQuadVertexCount; i++)
+		if (sData.Instanced)
+		{
+			const glm::vec2* coords = sData.QuadTextureCoordinates;
+			const glm::vec4 uvRect = {coords[0].x, coords[0].y, coords[2].x, coords[2].y};
+			WriteQuadInstance(sData.QuadInstanceBufferPtr++, transform, color, uvRect, textureIndex, tilingFactor, entityID);
+		}
+		else
 		{
-			sData.QuadVertexBufferPtr->Position = transform * sData.QuadVertexPositions[i];
-			sData.QuadVertexBufferPtr->Color = color;
-			sData.QuadVertexBufferPtr->TextureCoord = sData.QuadTextureCoordinates[i];
-			sData.QuadVertexBufferPtr->TextureIndex = textureIndex;
-			sData.QuadVertexBufferPtr->TilingFactor = tilingFactor;
-			sData.QuadVertexBufferPtr->EntityID = entityID;
-			sData.QuadVertexBufferPtr++;
+			WriteQuadVertices(sData.QuadVertexBufferPtr, transform, color, sData.QuadTextureCoordinates, textureIndex, tilingFactor, entityID);
+			sData.QuadVertexBufferPtr += Renderer2DData::kQuadVertexCount;
 		}
 
 		sData.QuadIndexCount += 6;
@@ -915,18 +2120,18 @@ namespace Hazel
 
 		if (sData.CircleIndexCount >= Renderer2DData::MaxIndices)
 		{
+			sData.Stats.CapacityFlushes++;
 			FlushAndReset();
 		}
 
-		for (const auto& quadVertexPosition : sData.QuadVertexPositions)
+		if (sData.Instanced)
+		{
+			WriteCircleInstance(sData.CircleInstanceBufferPtr++, transform, color, thickness, fade, entityID);
+		}
+		else
 		{
-			sData.CircleVertexBufferPtr->WorldPosition = transform * quadVertexPosition;
-			sData.CircleVertexBufferPtr->LocalPosition = quadVertexPosition * 2.0f;
-			sData.CircleVertexBufferPtr->Color = color;
-			sData.CircleVertexBufferPtr->Thickness = thickness;
-			sData.CircleVertexBufferPtr->Fade = fade;
-			sData.CircleVertexBufferPtr->EntityID = entityID;
-			sData.CircleVertexBufferPtr++;
+			WriteCircleVertices(sData.CircleVertexBufferPtr, transform, color, thickness, fade, entityID);
+			sData.CircleVertexBufferPtr += Renderer2DData::kQuadVertexCount;
 		}
 
 		sData.CircleIndexCount += 6;
@@ -25,6 +25,8 @@ namespace Hazel
 	constexpr const char* SHADER_PATH_CIRCLE = "assets/shaders/Renderer2D_Circle.glsl";
 	constexpr const char* SHADER_PATH_LINE = "assets/shaders/Renderer2D_Line.glsl";
 	constexpr const char* SHADER_PATH_TEXT = "assets/shaders/Renderer2D_Text.glsl";
+	constexpr const char* SHADER_PATH_QUAD_INSTANCED = "assets/shaders/Renderer2D_QuadInstanced.glsl";
+	constexpr const char* SHADER_PATH_CIRCLE_INSTANCED = "assets/shaders/Renderer2D_CircleInstanced.glsl";
 
 	class Renderer2D
 	{
@@ -32,15 +34,20 @@ namespace Hazel
 		static constexpr glm::mat4 _sIdentityMatrix = glm::identity<glm::mat4>();
 
 	public:
-		static void Init();
+		// Instanced draws quads and circles from one instance record each instead of four vertices.
+		static void Init(bool instanced = false);
 		static void Shutdown();
 
+		// Quads, sprites and circles are queued and drawn by EndScene in sort key order: by layer, opaque before
+		// translucent, opaque grouped by shader and texture, translucent back to front. Lines and text are drawn last.
 		static bool BeginScene(const Camera& camera, const glm::mat4& transform);
 		static bool BeginScene(const glm::mat4& viewProjection);
 
 		static void EndScene();
 		static void Flush();
 		static void Reset();
+		// Once per frame after the last scene, fences the streaming vertex buffers and releases the sprite textures resolved this frame.
+		static void EndFrame();
 
 		// --- Plain Quad --- //
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Color& color);
@@ -69,14 +76,41 @@ namespace Hazel
 		static void DrawQuad(const glm::mat4& transform, const Ref<SubTexture2D>& subTexture, const glm::vec2& tilingFactor = glm::vec2(1.0f), const Color& tintColor = Color::White);
 		// --- ----------- --- //
 
+		// --- Batched Quads --- //
+		// Submits count quads in one call, colors and entityIDs are per quad.
+		// uvRects are optional (min.x, min.y, max.x, max.y) per quad, nullptr uses the whole texture.
+		// Queued with a sort key per quad like single draws, translucent quads are ordered by depth within their layer.
+		static void DrawQuads(const glm::mat4* transforms, const Color* colors, uint32_t count, const int* entityIDs = nullptr, int layer = 0);
+		static void DrawQuads(const glm::mat4* transforms, const Color* colors, uint32_t count, const Ref<Texture2D>& texture, const glm::vec4* uvRects = nullptr, const glm::vec2& tilingFactor = glm::vec2(1.0f), const int* entityIDs = nullptr, int layer = 0);
+		// --- ----------- --- //
+
 		// --- Sprite --- //
 		// Final Draw
-		static void DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& spriteRenderComponent, int entityID);
+		static void DrawSprite(const glm::mat4& transform, const SpriteRendererComponent& spriteRenderComponent, int entityID, int layer = 0);
+		// --- ----------- --- //
+
+		// --- Static Quads --- //
+		// Quads that don't change between frames, their vertices are generated once and kept in GPU buffers.
+		struct StaticQuad
+		{
+			glm::mat4 Transform;
+			Color Color;
+			Ref<Texture2D> Texture; // nullptr draws a flat color.
+			glm::vec2 TilingFactor{1.0f, 1.0f};
+			int EntityID = -1;
+		};
+
+		struct StaticBatch;
+
+		// Call after Init, the batch is built for the current instanced mode and shaders.
+		static Ref<StaticBatch> CreateStaticBatch(const std::vector<StaticQuad>& quads);
+		// Queued like the other draws, not culled per quad.
+		static void DrawStaticBatch(const Ref<StaticBatch>& batch, int layer = 0);
 		// --- ----------- --- //
 
 		// --- Circle --- //
 		// Final Draw
-		static void DrawCircle(const glm::mat4& transform, const Color& color, float thickness = 1.0f, float fade = 0.005f, int entityID = -1);
+		static void DrawCircle(const glm::mat4& transform, const Color& color, float thickness = 1.0f, float fade = 0.005f, int entityID = -1, int layer = 0);
 		// --- ----------- --- //
 
 		// --- Line --- //
@@ -99,6 +133,13 @@ namespace Hazel
 		{
 			uint32_t DrawCalls = 0;
 			uint32_t QuadCount = 0;
+			uint32_t TextureSlotFlushes = 0; // Batches flushed because every texture slot was taken.
+			uint32_t FontAtlasFlushes = 0; // Batches flushed because text switched to another font atlas.
+			uint32_t CapacityFlushes = 0; // Batches flushed because a vertex buffer was full.
+			uint32_t OrderFlushes = 0; // Batches flushed to keep the sorted order between quads and circles.
+			uint32_t StaticQuadCount = 0; // Quads drawn from static batches, not part of QuadCount.
+			uint32_t TextureArrayPages = 0; // Texture arrays currently allocated.
+			uint32_t ResidentTextures = 0; // Textures copied into texture arrays.
 
 			uint32_t GetTotalVertexCount() const { return QuadCount * 4; }
 			uint32_t GetTotalIndexCount() const { return QuadCount * 6; }
@@ -107,12 +148,32 @@ namespace Hazel
 		static void ResetStats();
 		static Statistics GetStats();
 
+		// Time spent generating quad vertices, in milliseconds, with each kernel.
+		struct QuadKernelBenchmark
+		{
+			uint32_t QuadCount = 0;
+			float ReferenceMillis = 0.0f; // Per corner mat4 * vec4.
+			float ScalarMillis = 0.0f;
+			float SIMDMillis = 0.0f; // Same as Scalar when SIMD is not available.
+		};
+
+		static QuadKernelBenchmark BenchmarkQuadKernels(uint32_t quadCount = 100000, uint32_t iterations = 10);
+
 		static bool IsReady();
+		static bool IsInstanced();
+
+		// Copies textures loaded from files into texture arrays grouped by size and format, so a batch isn't
+		// limited by the texture slots. Call outside of BeginScene/EndScene, disabling releases the arrays.
+		static void SetTextureArraysEnabled(bool enabled);
+		static bool AreTextureArraysEnabled();
 		static void ReloadShader(RendererShader rendererShader);
 		static void LoadShadersAsync();
 
 	private:
 		static void FlushAndReset();
+		static void SubmitQueue();
+		static int GetTextureIndex(const Ref<Texture2D>& texture);
+		static int GetTextureArrayIndex(const Ref<Texture2D>& texture);
 		static void UpdateQuadData(const glm::mat4& transform, const Color& color, int entityID = -1, const glm::vec2& tilingFactor = glm::vec2(1.0f), int textureIndex = -1);
 		static void UpdateCircleData(const glm::mat4& transform, const Color& color, int entityID = -1, float thickness = 1.0f, float fade = 0.005f);
 
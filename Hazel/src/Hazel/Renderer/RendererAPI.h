@@ -27,8 +27,11 @@ namespace Hazel
 		virtual void SetClearColor(const Color& color) = 0;
 
 		virtual void Clear() = 0;
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
-		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) = 0;
+		// baseVertex is added to every index, used to draw from a region of a streaming vertex buffer.
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
+		virtual void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) = 0;
+		// Draws vertexCount vertices as a triangle strip for every instance, starting at instance baseInstance.
+		virtual void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) = 0;
 
 		virtual void SetLineWidth(float width) = 0;
 
@@ -3,6 +3,7 @@
 
 #include "Renderer.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Null/NullShader.h"
 
 namespace Hazel
 {
@@ -11,8 +12,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullShader>(filePath, shouldRecompile);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLShader>(filePath, shouldRecompile);
 		case RendererAPI::API::DirectX:
@@ -32,8 +32,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullShader>(name, vertexSrc, fragmentSrc);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
 		case RendererAPI::API::DirectX:
@@ -2,10 +2,171 @@
 #include "Texture.h"
 
 #include "Renderer.h"
+#include "TextureCache.h"
+#include "Hazel/Core/Timer.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Null/NullTexture.h"
+
+#include "stb_image.h"
 
 namespace Hazel
 {
+	namespace Utils
+	{
+		static uint64_t GetBytesPerPixel(ImageFormat format)
+		{
+			switch (format)
+			{
+			case ImageFormat::R8: return 1;
+			case ImageFormat::RGB8: return 3;
+			case ImageFormat::RGBA8: return 4;
+			case ImageFormat::RGBA32F: return 16;
+			default: return 0;
+			}
+		}
+
+		// The linear to sRGB table is fine enough for every byte to round trip.
+		struct SRGBTables
+		{
+			float ToLinear[256];
+			uint8_t ToSRGB[4096];
+
+			SRGBTables()
+			{
+				for (uint32_t i = 0; i < 256; i++)
+				{
+					const float value = static_cast<float>(i) / 255.0f;
+					ToLinear[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+				}
+
+				for (uint32_t i = 0; i < 4096; i++)
+				{
+					const float value = static_cast<float>(i) / 4095.0f;
+					const float encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+					ToSRGB[i] = static_cast<uint8_t>(encoded * 255.0f + 0.5f);
+				}
+			}
+		};
+
+		static const SRGBTables& GetSRGBTables()
+		{
+			static const SRGBTables tables;
+			return tables;
+		}
+
+		// 2x2 box filter, the last row or column of an odd size is reused. Alpha is linear already.
+		// Colors are weighted by their alpha, transparent texels don't bleed their color into the visible ones.
+		static void DownsampleSRGB(const uint8_t* source, uint32_t sourceWidth, uint32_t sourceHeight, uint32_t channels, uint8_t* destination, uint32_t width, uint32_t height)
+		{
+			const auto& tables = GetSRGBTables();
+			const uint32_t sourceStride = sourceWidth * channels;
+			const bool hasAlpha = channels == 4;
+
+			for (uint32_t y = 0; y < height; y++)
+			{
+				const uint8_t* rows[2] =
+				{
+					source + std::min(y * 2, sourceHeight - 1) * sourceStride,
+					source + std::min(y * 2 + 1, sourceHeight - 1) * sourceStride
+				};
+
+				for (uint32_t x = 0; x < width; x++)
+				{
+					const uint32_t columns[2] = {std::min(x * 2, sourceWidth - 1) * channels, std::min(x * 2 + 1, sourceWidth - 1) * channels};
+
+					float color[3] = {0.0f, 0.0f, 0.0f};
+					float unweightedColor[3] = {0.0f, 0.0f, 0.0f};
+					float alphaSum = 0.0f;
+					for (const uint8_t* row : rows)
+					{
+						for (const uint32_t column : columns)
+						{
+							const uint8_t* texel = row + column;
+							const float alpha = hasAlpha ? texel[3] / 255.0f : 1.0f;
+							for (uint32_t channel = 0; channel < 3; channel++)
+							{
+								const float linear = tables.ToLinear[texel[channel]];
+								color[channel] += linear * alpha;
+								unweightedColor[channel] += linear;
+							}
+							alphaSum += alpha;
+						}
+					}
+
+					// Fully transparent, the plain average keeps a sensible color for filtering.
+					const bool isTransparent = alphaSum <= 0.0f;
+					const float colorScale = isTransparent ? 0.25f : 1.0f / alphaSum;
+					const float* average = isTransparent ? unweightedColor : color;
+
+					uint8_t* output = destination + (static_cast<size_t>(y) * width + x) * channels;
+					for (uint32_t channel = 0; channel < 3; channel++)
+					{
+						output[channel] = tables.ToSRGB[static_cast<uint32_t>(std::min(average[channel] * colorScale, 1.0f) * 4095.0f + 0.5f)];
+					}
+
+					if (hasAlpha)
+					{
+						output[3] = static_cast<uint8_t>(alphaSum * 0.25f * 255.0f + 0.5f);
+					}
+				}
+			}
+		}
+	}
+
+	uint32_t Texture::CalculateMipLevelCount(uint32_t width, uint32_t height)
+	{
+		uint32_t levelCount = 1;
+		for (uint32_t size = std::max(width, height); size > 1; size /= 2)
+		{
+			levelCount++;
+		}
+		return levelCount;
+	}
+
+	uint64_t Texture::CalculateMemorySize(const TextureSpecification& specification, uint32_t mipLevelCount)
+	{
+		uint64_t size = 0;
+		uint32_t width = specification.Width;
+		uint32_t height = specification.Height;
+		for (uint32_t level = 0; level < mipLevelCount; level++)
+		{
+			size += static_cast<uint64_t>(width) * height * Utils::GetBytesPerPixel(specification.Format);
+			width = std::max(1u, width / 2);
+			height = std::max(1u, height / 2);
+		}
+		return size;
+	}
+
+	bool Texture::HasTranslucentTexels(const void* pixels, uint64_t size, ImageFormat format)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (format == ImageFormat::RGBA8)
+		{
+			const auto* texels = static_cast<const uint8_t*>(pixels);
+			for (uint64_t i = 3; i < size; i += 4)
+			{
+				if (texels[i] != 255)
+				{
+					return true;
+				}
+			}
+		}
+		else if (format == ImageFormat::RGBA32F)
+		{
+			const auto* texels = static_cast<const float*>(pixels);
+			for (uint64_t i = 3; i < size / sizeof(float); i += 4)
+			{
+				if (texels[i] < 1.0f)
+				{
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
 	// Assignment in Hazel::Application constructor, since the renderer need to be initialized.
 	Ref<Texture2D> Texture2D::ErrorTexture = nullptr;
 
@@ -14,8 +175,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullTexture2D>(specification);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLTexture2D>(specification);
 		case RendererAPI::API::DirectX:
@@ -35,8 +195,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullTexture2D>(path);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLTexture2D>(path);
 		case RendererAPI::API::DirectX:
@@ -50,4 +209,145 @@ namespace Hazel
 			return nullptr;
 		}
 	}
+
+	Ref<Texture2D> Texture2D::Create(const TextureImage& image)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			return CreateRef<NullTexture2D>(image);
+		case RendererAPI::API::OpenGL:
+			return CreateRef<OpenGLTexture2D>(image);
+		case RendererAPI::API::DirectX:
+			HZ_CORE_ASSERT(false, "RendererAPI::DirectX is currently not supported.");
+			return nullptr;
+		case RendererAPI::API::Vulkan:
+			HZ_CORE_ASSERT(false, "RendererAPI::Vulkan is currently not supported.");
+			return nullptr;
+		default:
+			HZ_CORE_ASSERT(false, "Unknown RendererAPI, Texture2D::Create");
+			return nullptr;
+		}
+	}
+
+	TextureImage Texture2D::Decode(const std::filesystem::path& path, bool generateMips)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		TextureImage image;
+		image.Path = path;
+
+		Timer timer;
+		auto source = TextureCache::GetSource(path);
+		float decodeMillis = 0.0f;
+		if (TextureCache::TryLoad(source, generateMips, image, decodeMillis))
+		{
+			HZ_CORE_LTRACE("Texture {0} read from cache in {1}ms, decoding took {2}ms", path.string(), timer.ElapsedMillis(), decodeMillis);
+
+			// Only hashed when the write time changed, the entry is refreshed so the next load skips the hash.
+			if (source.Hash != 0)
+			{
+				TextureCache::Store(source, image, decodeMillis);
+			}
+
+			return image;
+		}
+
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load_thread(1);
+
+		stbi_uc* data = nullptr;
+		{
+			HZ_PROFILE_SCOPE("stbi_load");
+			data = stbi_load(path.string().c_str(), &width, &height, &channels, 0);
+
+			// Grey and grey alpha images are expanded, only RGB8 and RGBA8 are uploaded.
+			if (data && channels != 3 && channels != 4)
+			{
+				stbi_image_free(data);
+				data = stbi_load(path.string().c_str(), &width, &height, &channels, 4);
+				channels = 4;
+			}
+		}
+
+		if (!data)
+		{
+			HZ_CORE_LERROR("Failed to load image {0}", path.string());
+			image.Specification.Width = 1;
+			image.Specification.Height = 1;
+			image.Specification.Format = ImageFormat::RGBA8;
+			image.Specification.GenerateMips = false;
+			image.Specification.HasTranslucency = false;
+			image.Pixels = {255, 128, 255, 255};
+			return image;
+		}
+
+		image.Specification.Width = width;
+		image.Specification.Height = height;
+		image.Specification.Format = channels == 4 ? ImageFormat::RGBA8 : ImageFormat::RGB8;
+		image.Specification.GenerateMips = generateMips;
+		image.Pixels.assign(data, data + static_cast<size_t>(width) * height * channels);
+		image.Specification.HasTranslucency = HasTranslucentTexels(image.Pixels.data(), image.Pixels.size(), image.Specification.Format);
+
+		stbi_image_free(data);
+
+		if (generateMips)
+		{
+			GenerateMips(image);
+		}
+
+		TextureCache::Store(source, image, timer.ElapsedMillis());
+
+		return image;
+	}
+
+	void Texture2D::GenerateMips(TextureImage& image)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const auto& specification = image.Specification;
+		HZ_CORE_ASSERT(specification.Format == ImageFormat::RGB8 || specification.Format == ImageFormat::RGBA8, "Mips are only generated for RGB8 and RGBA8!");
+
+		const uint32_t channels = specification.Format == ImageFormat::RGBA8 ? 4 : 3;
+		const uint32_t levelCount = CalculateMipLevelCount(specification.Width, specification.Height);
+
+		image.Mips.clear();
+		image.Mips.reserve(levelCount - 1);
+
+		uint32_t width = specification.Width;
+		uint32_t height = specification.Height;
+		const uint8_t* previousLevel = image.Pixels.data();
+		for (uint32_t level = 1; level < levelCount; level++)
+		{
+			const uint32_t levelWidth = std::max(1u, width / 2);
+			const uint32_t levelHeight = std::max(1u, height / 2);
+
+			auto& mip = image.Mips.emplace_back(static_cast<size_t>(levelWidth) * levelHeight * channels);
+			Utils::DownsampleSRGB(previousLevel, width, height, channels, mip.data(), levelWidth, levelHeight);
+
+			previousLevel = mip.data();
+			width = levelWidth;
+			height = levelHeight;
+		}
+	}
+
+	Ref<Texture2DArray> Texture2DArray::Create(const TextureSpecification& specification, uint32_t layerCount, uint32_t magFilter)
+	{
+		switch (Renderer::GetAPI())
+		{
+		case RendererAPI::API::None:
+			return CreateRef<NullTexture2DArray>(specification, layerCount, magFilter);
+		case RendererAPI::API::OpenGL:
+			return CreateRef<OpenGLTexture2DArray>(specification, layerCount, magFilter);
+		case RendererAPI::API::DirectX:
+			HZ_CORE_ASSERT(false, "RendererAPI::DirectX is currently not supported.");
+			return nullptr;
+		case RendererAPI::API::Vulkan:
+			HZ_CORE_ASSERT(false, "RendererAPI::Vulkan is currently not supported.");
+			return nullptr;
+		default:
+			HZ_CORE_ASSERT(false, "Unknown RendererAPI, Texture2DArray::Create");
+			return nullptr;
+		}
+	}
 }
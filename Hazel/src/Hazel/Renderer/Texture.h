@@ -18,6 +18,17 @@ namespace Hazel
 		uint32_t Height = 1;
 		ImageFormat Format = ImageFormat::RGBA8;
 		bool GenerateMips = true;
+		// Some texel has an alpha below one. Updated when the pixels are known, until then a format with alpha counts as translucent.
+		bool HasTranslucency = true;
+	};
+
+	// Pixels of an image file decoded on the CPU, decoding does not touch the renderer and can run on any thread.
+	struct TextureImage
+	{
+		std::filesystem::path Path;
+		TextureSpecification Specification;
+		std::vector<uint8_t> Pixels;
+		std::vector<std::vector<uint8_t>> Mips; // Levels below the base one, each half the size of the previous one.
 	};
 
 	class Texture
@@ -33,7 +44,11 @@ namespace Hazel
 		virtual void* GetRawID() const = 0;
 		virtual const std::filesystem::path& GetPath() const = 0;
 		virtual uint32_t GetMagFilter() const = 0;
+		virtual uint32_t GetMipLevelCount() const = 0;
+		// GPU memory of every level.
+		virtual uint64_t GetMemorySize() const = 0;
 
+		// Level 0, the levels below are generated from it when the texture has mips.
 		virtual void SetData(void* data, uint32_t size) = 0;
 		virtual void SetMagFilter(uint32_t magFilter) = 0;
 		virtual void ToggleMagFilter(uint32_t magFilter) = 0;
@@ -42,6 +57,11 @@ namespace Hazel
 		virtual void Bind(uint32_t slot = 0) const = 0;
 		virtual bool Equals(const Texture& other) const = 0;
 		virtual bool operator==(const Texture& other) const = 0;
+
+		static uint32_t CalculateMipLevelCount(uint32_t width, uint32_t height);
+		static uint64_t CalculateMemorySize(const TextureSpecification& specification, uint32_t mipLevelCount);
+		// False for formats without alpha.
+		static bool HasTranslucentTexels(const void* pixels, uint64_t size, ImageFormat format);
 	};
 
 	class Texture2D : public Texture
@@ -50,5 +70,32 @@ namespace Hazel
 		static Ref<Texture2D> ErrorTexture;
 		static Ref<Texture2D> Create(const TextureSpecification& specification);
 		static Ref<Texture2D> Create(const std::filesystem::path& path);
+		static Ref<Texture2D> Create(const TextureImage& image);
+
+		// A file that cannot be decoded gives a single pink pixel.
+		static TextureImage Decode(const std::filesystem::path& path, bool generateMips = true);
+		// Box filtered in linear space, the color channels are sRGB encoded.
+		static void GenerateMips(TextureImage& image);
+	};
+
+	// Layers of the same size and format sampled through a single binding.
+	class Texture2DArray
+	{
+	public:
+		virtual ~Texture2DArray() = default;
+
+		virtual const TextureSpecification& GetSpecification() const = 0;
+
+		virtual uint32_t GetLayerCount() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+		virtual uint32_t GetMagFilter() const = 0;
+		virtual uint32_t GetMipLevelCount() const = 0;
+
+		// Copies the texture into the layer on the GPU, its size, format and levels must match the array.
+		virtual void CopyToLayer(uint32_t layer, const Texture2D& texture) = 0;
+
+		virtual void Bind(uint32_t slot = 0) const = 0;
+
+		static Ref<Texture2DArray> Create(const TextureSpecification& specification, uint32_t layerCount, uint32_t magFilter);
 	};
 }
@@ -0,0 +1,280 @@
+#include "hzpch.h"
+#include "TextureCache.h"
+
+#include "Hazel/Core/MappedFile.h"
+
+#include <fstream>
+#include <thread>
+
+namespace Hazel
+{
+	namespace Utils
+	{
+		static std::filesystem::path GetTextureCacheDirectory()
+		{
+			// Decode workers may race to create it, an existing directory is not an error.
+			std::filesystem::path cacheDirectory = "assets/cache/texture";
+			std::error_code error;
+			std::filesystem::create_directories(cacheDirectory, error);
+
+			return cacheDirectory;
+		}
+
+		// FNV-1a over 8 byte words with a shift to carry the high bits down, the key only has to tell file versions apart.
+		static uint64_t HashBytes(const uint8_t* data, uint64_t size)
+		{
+			constexpr uint64_t kPrime = 0x100000001b3ull;
+
+			uint64_t hash = 0xcbf29ce484222325ull ^ size;
+			uint64_t offset = 0;
+			for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+			{
+				uint64_t word;
+				memcpy(&word, data + offset, sizeof(uint64_t));
+				hash = (hash ^ word) * kPrime;
+				hash ^= hash >> 29;
+			}
+
+			for (; offset < size; offset++)
+			{
+				hash = (hash ^ data[offset]) * kPrime;
+			}
+
+			return hash != 0 ? hash : 1;
+		}
+
+		// Named after the source path, writing the entry of a changed file replaces the previous one.
+		static std::filesystem::path GetCachedTexturePath(const std::filesystem::path& sourcePath, bool hasMips)
+		{
+			const std::string key = sourcePath.generic_string();
+			const uint64_t pathHash = HashBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+			return GetTextureCacheDirectory() / fmt::format("{:016x}{}.hztex", pathHash, hasMips ? "_mips" : "");
+		}
+	}
+
+	namespace TextureCacheFormat
+	{
+		static constexpr char kMagic[4] = {'H', 'Z', 'T', 'X'};
+		static constexpr uint32_t kVersion = 4;
+
+		// Followed by the levels, largest first, tightly packed.
+		struct Header
+		{
+			char Magic[4];
+			uint32_t Version;
+			uint32_t Width;
+			uint32_t Height;
+			uint32_t Format;
+			uint32_t LevelCount;
+			float DecodeMillis;
+			uint32_t HasTranslucency;
+			uint64_t SourceHash;
+			uint64_t SourceSize;
+			int64_t SourceWriteTime;
+		};
+		static_assert(sizeof(Header) == 56, "Header layout changed");
+	}
+
+	TextureCache::Source TextureCache::GetSource(const std::filesystem::path& filePath)
+	{
+		std::error_code error;
+		if (!std::filesystem::is_regular_file(filePath, error))
+		{
+			return {};
+		}
+
+		Source source;
+		source.Size = std::filesystem::file_size(filePath, error);
+		if (error)
+		{
+			return {};
+		}
+
+		source.WriteTime = std::filesystem::last_write_time(filePath, error).time_since_epoch().count();
+		if (error)
+		{
+			return {};
+		}
+
+		source.Path = std::filesystem::absolute(filePath, error).lexically_normal();
+		return error ? Source() : source;
+	}
+
+	uint64_t TextureCache::HashFile(const std::filesystem::path& filePath)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::error_code error;
+		if (!std::filesystem::is_regular_file(filePath, error))
+		{
+			return 0;
+		}
+
+		const MappedFile file(filePath);
+		if (!file)
+		{
+			return 0;
+		}
+
+		return Utils::HashBytes(file.GetData(), file.GetSize());
+	}
+
+	bool TextureCache::TryLoad(Source& source, bool hasMips, TextureImage& outImage, float& outDecodeMillis)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		using namespace TextureCacheFormat;
+
+		if (!source)
+		{
+			return false;
+		}
+
+		const auto cachedPath = Utils::GetCachedTexturePath(source.Path, hasMips);
+		std::error_code error;
+		if (!std::filesystem::exists(cachedPath, error))
+		{
+			return false;
+		}
+
+		const MappedFile file(cachedPath);
+		if (!file || file.GetSize() < sizeof(Header))
+		{
+			return false;
+		}
+
+		Header header;
+		memcpy(&header, file.GetData(), sizeof(Header));
+		if (memcmp(header.Magic, kMagic, sizeof(kMagic)) != 0 || header.Version != kVersion)
+		{
+			HZ_CORE_LWARN("Ignoring outdated texture cache {0}", cachedPath.string());
+			return false;
+		}
+
+		// A touched file keeps its entry as long as the contents are the same, with the hash kept in source for the caller to
+		// store the entry again under the new write time.
+		const bool isSameFile = header.SourceSize == source.Size && header.SourceWriteTime == source.WriteTime;
+		if (!isSameFile)
+		{
+			if (source.Hash == 0)
+			{
+				source.Hash = HashFile(source.Path);
+			}
+
+			if (header.SourceHash != source.Hash)
+			{
+				HZ_CORE_LTRACE("Texture cache {0} is out of date, {1} changed", cachedPath.string(), source.Path.string());
+				return false;
+			}
+		}
+
+		TextureSpecification specification;
+		specification.Width = header.Width;
+		specification.Height = header.Height;
+		specification.Format = static_cast<ImageFormat>(header.Format);
+		specification.GenerateMips = hasMips;
+		specification.HasTranslucency = header.HasTranslucency != 0;
+
+		const uint32_t levelCount = hasMips ? Texture::CalculateMipLevelCount(header.Width, header.Height) : 1;
+		const bool isFormatSupported = specification.Format == ImageFormat::RGB8 || specification.Format == ImageFormat::RGBA8;
+		if (!isFormatSupported || header.LevelCount != levelCount || file.GetSize() != sizeof(Header) + Texture::CalculateMemorySize(specification, levelCount))
+		{
+			HZ_CORE_LWARN("Ignoring corrupted texture cache {0}", cachedPath.string());
+			return false;
+		}
+
+		const uint64_t channels = specification.Format == ImageFormat::RGBA8 ? 4 : 3;
+		const uint8_t* levelData = file.GetData() + sizeof(Header);
+		uint32_t width = specification.Width;
+		uint32_t height = specification.Height;
+
+		outImage.Specification = specification;
+		outImage.Mips.clear();
+		outImage.Mips.reserve(levelCount - 1);
+		for (uint32_t level = 0; level < levelCount; level++)
+		{
+			const uint64_t levelSize = static_cast<uint64_t>(width) * height * channels;
+			if (level == 0)
+			{
+				outImage.Pixels.assign(levelData, levelData + levelSize);
+			}
+			else
+			{
+				outImage.Mips.emplace_back(levelData, levelData + levelSize);
+			}
+
+			levelData += levelSize;
+			width = std::max(1u, width / 2);
+			height = std::max(1u, height / 2);
+		}
+
+		outDecodeMillis = header.DecodeMillis;
+		return true;
+	}
+
+	void TextureCache::Store(Source& source, const TextureImage& image, float decodeMillis)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		using namespace TextureCacheFormat;
+
+		if (!source)
+		{
+			return;
+		}
+
+		if (source.Hash == 0)
+		{
+			source.Hash = HashFile(source.Path);
+		}
+
+		// Changed while it was decoded, the image may not match the hash.
+		const Source current = GetSource(source.Path);
+		if (current.Size != source.Size || current.WriteTime != source.WriteTime)
+		{
+			return;
+		}
+
+		const auto& specification = image.Specification;
+		const auto cachedPath = Utils::GetCachedTexturePath(source.Path, specification.GenerateMips);
+
+		// Written aside and moved in place, a reader never maps a partial file.
+		auto temporaryPath = cachedPath;
+		temporaryPath += fmt::format(".{}.tmp", std::hash<std::thread::id>()(std::this_thread::get_id()));
+		{
+			std::ofstream out(temporaryPath, std::ios::out | std::ios::binary);
+			if (!out.is_open())
+			{
+				HZ_CORE_LWARN("Failed to write texture cache {0}", cachedPath.string());
+				return;
+			}
+
+			Header header{};
+			memcpy(header.Magic, kMagic, sizeof(kMagic));
+			header.Version = kVersion;
+			header.Width = specification.Width;
+			header.Height = specification.Height;
+			header.Format = static_cast<uint32_t>(specification.Format);
+			header.LevelCount = static_cast<uint32_t>(image.Mips.size() + 1);
+			header.DecodeMillis = decodeMillis;
+			header.HasTranslucency = specification.HasTranslucency;
+			header.SourceHash = source.Hash;
+			header.SourceSize = source.Size;
+			header.SourceWriteTime = source.WriteTime;
+
+			out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+			out.write(reinterpret_cast<const char*>(image.Pixels.data()), image.Pixels.size());
+			for (const auto& mip : image.Mips)
+			{
+				out.write(reinterpret_cast<const char*>(mip.data()), mip.size());
+			}
+		}
+
+		std::error_code error;
+		std::filesystem::rename(temporaryPath, cachedPath, error);
+		if (error)
+		{
+			std::filesystem::remove(temporaryPath, error);
+		}
+	}
+}
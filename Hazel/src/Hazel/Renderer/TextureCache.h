@@ -0,0 +1,31 @@
+#pragma once
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel
+{
+	// Decoded images, mips included, stored under assets/cache/texture with one entry per source file.
+	// An entry is replaced when its source changes, its size and write time are checked first and the contents are only
+	// hashed when those differ. A cached image is memory-mapped and copied out as is.
+	class TextureCache
+	{
+	public:
+		struct Source
+		{
+			std::filesystem::path Path;
+			uint64_t Size = 0;
+			int64_t WriteTime = 0;
+			uint64_t Hash = 0; // Hash of the contents, 0 until it was needed.
+
+			operator bool() const { return !Path.empty(); }
+		};
+
+		// Empty when the file can't be read.
+		static Source GetSource(const std::filesystem::path& filePath);
+		// 0 when the file can't be read.
+		static uint64_t HashFile(const std::filesystem::path& filePath);
+
+		// Hashes the source when its size or write time changed, the hash is kept for Store.
+		static bool TryLoad(Source& source, bool hasMips, TextureImage& outImage, float& outDecodeMillis);
+		static void Store(Source& source, const TextureImage& image, float decodeMillis);
+	};
+}
@@ -3,6 +3,7 @@
 
 #include "Hazel/Renderer/Renderer.h"
 #include "Platform/OpenGL/OpenGLUniformBuffer.h"
+#include "Platform/Null/NullUniformBuffer.h"
 
 
 namespace Hazel
@@ -12,8 +13,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullUniformBuffer>(size, binding);
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLUniformBuffer>(size, binding);
 		case RendererAPI::API::DirectX:
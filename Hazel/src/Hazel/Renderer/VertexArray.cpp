@@ -3,6 +3,7 @@
 #include "Renderer.h"
 
 #include "Platform/OpenGL/OpenGLVertexArray.h"
+#include "Platform/Null/NullVertexArray.h"
 
 namespace Hazel
 {
@@ -11,8 +12,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullVertexArray>();
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLVertexArray>();
 		case RendererAPI::API::DirectX:
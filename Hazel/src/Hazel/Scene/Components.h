@@ -3,9 +3,12 @@
 #include "Hazel/Core/Color.h"
 #include "SceneCamera.h"
 #include "Hazel/Core/UUID.h"
+#include "Hazel/Asset/AssetManager.h"
 #include "Hazel/Renderer/Texture.h"
 #include "Hazel/Audio/AudioSource.h"
 
+#include <atomic>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -51,17 +54,25 @@ namespace Hazel
 		UUID ChildID = 0;
 		UUID NextSiblingID = 0;
 		UUID PreviousSiblingID = 0;
+		UUID LastChildID = 0; // Not serialized, lets the Scene append a child without walking the siblings.
 
 		FamilyComponent() = default;
 		FamilyComponent(const FamilyComponent&) = default;
 	};
 
-	// TODO Add static and dynamic so transform for statics do no have to be recalculated all the way down the parent line
+	// Static transforms are not expected to move while the scene runs, their world transforms and sprites are baked.
+	enum class TransformMobility : uint8_t
+	{
+		Dynamic = 0,
+		Static = 1
+	};
+
 	struct TransformComponent 
 	{
 		glm::vec3 Position{0.0f, 0.0f, 0.0f};
 		glm::vec3 Rotation{0.0f, 0.0f, 0.0f};
 		glm::vec3 Scale{1.0f, 1.0f, 1.0f};
+		TransformMobility Mobility = TransformMobility::Dynamic;
 
 		const TransformComponent* ParentTransform = nullptr;
 
@@ -97,14 +108,53 @@ namespace Hazel
 			}
 		}
 
+		// Cached, only recomputed when the local values or an ancestor changed since it was last computed.
 		glm::mat4 GetWorldTransformMatrix() const
+		{
+			UpdateWorldTransform();
+			return _worldTransform;
+		}
+
+		// Skips the change checks, only valid right after Scene::UpdateWorldTransforms with no edit since.
+		const glm::mat4& GetCachedWorldTransformMatrix() const { return _worldTransform; }
+		uint64_t GetWorldVersion() const { return _worldVersion; }
+
+		// Static with only static ancestors, set when the scene's TransformHierarchy is rebuilt.
+		bool IsInStaticSubtree() const { return _isInStaticSubtree; }
+
+		void UpdateWorldTransform() const
 		{
 			if (ParentTransform)
 			{
-				return ParentTransform->GetWorldTransformMatrix() * GetLocalTransformMatrix();
+				ParentTransform->UpdateWorldTransform();
+			}
+
+			if (!IsWorldTransformCurrent())
+			{
+				StoreWorldTransform(ParentTransform ? ParentTransform->_worldTransform * GetLocalTransformMatrix() : GetLocalTransformMatrix());
 			}
+		}
+
+		// Whether the cached world transform still matches the local values, assuming the parent is up to date.
+		bool IsWorldTransformCurrent() const
+		{
+			const uint64_t parentVersion = ParentTransform ? ParentTransform->_worldVersion : 0;
+			return _worldVersion != 0 && parentVersion == _parentVersion
+				&& Position == _cachedPosition && Rotation == _cachedRotation && Scale == _cachedScale;
+		}
 
-			return GetLocalTransformMatrix();
+		// Caches a world transform computed from the current local values, see TransformHierarchy.
+		void StoreWorldTransform(const glm::mat4& worldTransform) const
+		{
+			_cachedPosition = Position;
+			_cachedRotation = Rotation;
+			_cachedScale = Scale;
+			_parentVersion = ParentTransform ? ParentTransform->_worldVersion : 0;
+			_worldTransform = worldTransform;
+
+			// Versions are unique across all transforms, children notice a new or reparented parent the same way.
+			// Atomic since the transforms of a hierarchy level may be stored from several threads.
+			_worldVersion = _sWorldVersionCounter.fetch_add(1, std::memory_order_relaxed) + 1;
 		}
 
 		glm::mat4 GetLocalTransformMatrix() const
@@ -131,13 +181,26 @@ namespace Hazel
 
 			return worldTransform;
 		}
+
+	private:
+		mutable glm::mat4 _worldTransform{1.0f};
+		mutable glm::vec3 _cachedPosition{0.0f, 0.0f, 0.0f};
+		mutable glm::vec3 _cachedRotation{0.0f, 0.0f, 0.0f};
+		mutable glm::vec3 _cachedScale{1.0f, 1.0f, 1.0f};
+		mutable uint64_t _worldVersion = 0; // 0 until first computed.
+		mutable uint64_t _parentVersion = 0; // Version of the parent world transform this was computed from.
+		bool _isInStaticSubtree = false;
+
+		static inline std::atomic<uint64_t> _sWorldVersionCounter = 0;
+
+		friend class TransformHierarchy;
 	};
 #pragma endregion
 
 #pragma region Graphics
 	struct SpriteRendererComponent
 	{
-		Ref<Texture2D> Texture = nullptr;
+		AssetHandle TextureHandle = UUID::Invalid;
 		glm::vec2 Tiling{1.0f, 1.0f};
 		Color Color{Color::White};
 
@@ -211,6 +274,14 @@ namespace Hazel
 			};
 		}
 	};
+
+	class ScriptInstance;
+
+	// Added while running to the entities with a managed instance, so dispatch needs no UUID lookup. Never serialized or copied.
+	struct ScriptInstanceComponent
+	{
+		Ref<ScriptInstance> Instance = nullptr;
+	};
 #pragma endregion
 
 #pragma region Physics
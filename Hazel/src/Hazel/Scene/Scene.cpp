@@ -4,8 +4,11 @@
 #include "ScriptableEntity.h"
 
 #include "Hazel/Core/Random.h"
+#include "Hazel/Core/Timer.h"
 #include "Hazel/Renderer/Renderer2D.h"
 #include "Hazel/Scripting/ScriptEngine.h"
+#include "Hazel/Scripting/ScriptClass.h"
+#include "Hazel/Scripting/ScriptInstance.h"
 #include "Hazel/Audio/AudioEngine.h"
 #include "Hazel/Physics/Physics2D.h"
 
@@ -15,27 +18,44 @@
 #include "box2d/b2_polygon_shape.h"
 #include "box2d/b2_circle_shape.h"
 
+#include <map>
+
 namespace Hazel
 {
+	// Entities must have the same handles in both registries, each pool is copied in one pass without lookups.
+	// Pools are walked in reverse so the copy keeps the packed order, and with it the iteration order.
 	template<typename... Component>
-	static void CopyComponent(entt::registry& dst, const entt::registry& src, const std::unordered_map<UUID, entt::entity>& enttMap)
+	static void ClonePool(entt::registry& dst, const entt::registry& src)
 	{
 		([&]()
 		{
-			auto view = src.view<Component>();
-			for (auto srcEntity : view)
+			const auto& srcStorage = src.storage<Component>();
+			const entt::sparse_set& srcEntities = srcStorage;
+			if constexpr (std::is_empty_v<Component>)
+			{
+				dst.insert<Component>(srcEntities.rbegin(), srcEntities.rend());
+			}
+			else
 			{
-				entt::entity dstEntity = enttMap.at(src.get<IDComponent>(srcEntity).ID);
-				auto& srcComponent = src.get<Component>(srcEntity);
-				dst.emplace_or_replace<Component>(dstEntity, srcComponent);
+				dst.insert<Component>(srcEntities.rbegin(), srcEntities.rend(), srcStorage.rbegin());
 			}
 		}(), ...);
 	}
 
 	template<typename... Component>
-	static void CopyComponents(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src, const std::unordered_map<UUID, entt::entity>& enttMap)
+	static void ClonePools(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src)
 	{
-		CopyComponent<Component...>(dst, src, enttMap);
+		ClonePool<Component...>(dst, src);
+	}
+
+	// Takes over the entity handles, root included, so an entity map of src is valid as is for dst.
+	static void CloneRegistry(entt::registry& dst, const entt::registry& src)
+	{
+		dst.clear();
+		dst.assign(src.data(), src.data() + src.size(), src.released());
+
+		ClonePool<Root, IDComponent, FamilyComponent, BaseComponent>(dst, src);
+		ClonePools(AllComponents{}, dst, src);
 	}
 
 	template<typename... Component>
@@ -82,7 +102,8 @@ namespace Hazel
 		baseComponent.Tag = 0;
 		baseComponent.Layer = 0;
 
-		rootEntity.AddComponent<TransformComponent>();
+		// Lets top level entities be static, the root never moves.
+		rootEntity.AddComponent<TransformComponent>().Mobility = TransformMobility::Static;
 
 		_entityMap[uuid] = rootEntity;
 	}
@@ -107,26 +128,156 @@ namespace Hazel
 		newScene->_shouldCloneAudioSource = other->_shouldCloneAudioSource;
 		newScene->_isPaused = other->_isPaused;
 
-		auto group = other->GetEntitiesGroupWith<IDComponent, BaseComponent>();
-		for (const auto [enttID, idComponent, baseComponent] : group.each())
+		CloneRegistry(newScene->_registry, other->_registry);
+		newScene->_rootEntt = other->_rootEntt;
+		newScene->_entityMap = other->_entityMap;
+
+		// The parent transform pointers still point into the other scene.
+		newScene->_transformHierarchy.Rebuild(newScene->_registry, newScene->_entityMap);
+		newScene->_isTransformHierarchyDirty = false;
+
+		return newScene;
+	}
+
+	void Scene::SaveSnapshot(const std::string& name)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		auto& snapshot = _snapshots[name];
+		if (snapshot == nullptr)
+		{
+			snapshot = CreateScope<Snapshot>();
+		}
+
+		CloneRegistry(snapshot->Registry, _registry);
+		snapshot->RootEntt = _rootEntt;
+		snapshot->EntityMap = _entityMap;
+
+		snapshot->ScriptFields.clear();
+		for (auto&& [enttID, component] : GetEntitiesViewWith<ScriptComponent>().each())
+		{
+			Entity entity = {enttID, this};
+			auto& fields = snapshot->ScriptFields[entity.GetUUID()];
+			fields = ScriptEngine::GetScriptFieldMap(entity);
+
+			const auto instance = _isRunning ? ScriptEngine::GetEntityScriptInstance(entity) : nullptr;
+			if (!instance)
+			{
+				continue;
+			}
+
+			// The instance holds the current values, the field map only the ones it started with.
+			for (const auto& [fieldName, field] : instance->GetScriptClass()->GetFields())
+			{
+				auto& fieldInstance = fields[fieldName];
+				fieldInstance.Field = field;
+
+				switch (field.Type)
+				{
+				case ScriptFieldType::String:
+				{
+					fieldInstance.SetStringValue(instance->GetFieldStringValue(field));
+					break;
+				}
+				case ScriptFieldType::Entity:
+				{
+					const Entity fieldEntity = instance->GetFieldEntityValue(field);
+					fieldInstance.SetValue<uint64_t>(fieldEntity ? static_cast<uint64_t>(fieldEntity.GetUUID()) : 0);
+					break;
+				}
+				default:
+				{
+					fieldInstance.SetValue(instance->GetFieldValue<glm::vec4>(field));
+					break;
+				}
+				}
+			}
+		}
+	}
+
+	bool Scene::RestoreSnapshot(const std::string& name)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const auto it = _snapshots.find(name);
+		if (it == _snapshots.end())
 		{
-			const auto uuid = idComponent.ID;
+			HZ_CORE_LWARN("Scene [{0}] has no snapshot [{1}]", _name, name);
+			return false;
+		}
 
-			const auto& name = baseComponent.Name;
-			const auto& tag = baseComponent.Tag;
-			const auto& layer = baseComponent.Layer;
+		Timer timer;
+		const Snapshot& snapshot = *it->second;
 
-			newScene->CreateEntityWithUUID(uuid, name, tag, layer);
+		// Script instances, native scripts and physics bodies refer to the entities being replaced,
+		// they are recreated from the restored components.
+		const bool wasRunning = _isRunning;
+		const bool wasSimulating = !_isRunning && _physicsWorld != nullptr;
+		if (wasRunning)
+		{
+			for (auto&& [enttID, component] : GetEntitiesViewWith<NativeScriptComponent>().each())
+			{
+				if (component.Instance != nullptr)
+				{
+					component.Instance->OnDestroy();
+					component.DestroyScript(&component);
+				}
+			}
+
+			OnRuntimeStop();
+		}
+		else if (wasSimulating)
+		{
+			OnPhysic2DStop();
 		}
 
-		auto& srcSceneRegistry = other->_registry;
-		auto& dstSceneRegistry = newScene->_registry;
+		CloneRegistry(_registry, snapshot.Registry);
+		_rootEntt = snapshot.RootEntt;
+		_entityMap = snapshot.EntityMap;
 
-		// Copy components
-		CopyComponents(AllComponents{}, dstSceneRegistry, srcSceneRegistry, newScene->_entityMap);
-		CopyComponent<FamilyComponent>(dstSceneRegistry, srcSceneRegistry, newScene->_entityMap);
+		// Copies of instances destroyed above.
+		for (auto&& [enttID, component] : GetEntitiesViewWith<NativeScriptComponent>().each())
+		{
+			component.Instance = nullptr;
+		}
 
-		return newScene;
+		_transformHierarchy.Rebuild(_registry, _entityMap);
+		_isTransformHierarchyDirty = false;
+		_isStaticGeometryDirty = true;
+
+		if (wasRunning)
+		{
+			// The field maps are shared with the edited scene, the captured values are only used to create the instances.
+			std::unordered_map<UUID, ScriptFieldMap> editedFields;
+			for (const auto& [uuid, fields] : snapshot.ScriptFields)
+			{
+				auto& entityFields = ScriptEngine::GetScriptFieldMap(GetEntityByUUID(uuid));
+				editedFields[uuid] = std::move(entityFields);
+				entityFields = fields;
+			}
+
+			OnRuntimeStart();
+
+			for (auto& [uuid, fields] : editedFields)
+			{
+				ScriptEngine::GetScriptFieldMap(GetEntityByUUID(uuid)) = std::move(fields);
+			}
+		}
+		else
+		{
+			for (const auto& [uuid, fields] : snapshot.ScriptFields)
+			{
+				ScriptEngine::GetScriptFieldMap(GetEntityByUUID(uuid)) = fields;
+			}
+
+			if (wasSimulating)
+			{
+				OnPhysic2DStart();
+			}
+		}
+
+		HZ_CORE_LINFO("Scene [{0}] restored snapshot [{1}] of {2} entities in {3}ms", _name, name, _entityMap.size(), timer.ElapsedMillis());
+		return true;
 	}
 
 	Entity Scene::CreateEntity(const std::string& name, int tag, int layer)
@@ -135,6 +286,16 @@ namespace Hazel
 	}
 
 	Entity Scene::CreateEntityWithUUID(UUID uuid, const std::string& name, int tag, int layer)
+	{
+		Entity entity = CreateUnlinkedEntityWithUUID(uuid, name, tag, layer);
+
+		// TODO Add create entity with parent.
+		ReparentEntity(GetRootEntity(), entity);
+
+		return entity;
+	}
+
+	Entity Scene::CreateUnlinkedEntityWithUUID(UUID uuid, const std::string& name, int tag, int layer)
 	{
 		Entity entity = {_registry.create(), this};
 
@@ -150,13 +311,85 @@ namespace Hazel
 		entity.AddComponent<TransformComponent>();
 
 		_entityMap[uuid] = entity;
-
-		// TODO Add create entity with parent.
-		ReparentEntity(GetRootEntity(), entity);
+		_isTransformHierarchyDirty = true;
 
 		return entity;
 	}
 
+	void Scene::CreateUnlinkedEntities(const uint64_t* uuids, uint32_t count, entt::entity* entities, const TransformComponent* transforms)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		// The default components of every entity are added pool by pool instead of entity by entity.
+		_registry.create(entities, entities + count);
+		_registry.insert<IDComponent>(entities, entities + count);
+		_registry.insert<FamilyComponent>(entities, entities + count);
+		_registry.insert<BaseComponent>(entities, entities + count);
+		if (transforms)
+		{
+			_registry.insert<TransformComponent>(entities, entities + count, transforms);
+		}
+		else
+		{
+			_registry.insert<TransformComponent>(entities, entities + count);
+		}
+
+		ReserveEntities(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			_registry.get<IDComponent>(entities[i]).ID = uuids[i];
+			_entityMap[uuids[i]] = entities[i];
+		}
+
+		_isTransformHierarchyDirty = true;
+	}
+
+	void Scene::LinkFamilies()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::vector<Entity> orphans;
+		for (const auto&& [enttID, family] : _registry.view<FamilyComponent>(entt::exclude<Root>).each())
+		{
+			Entity parent = GetEntityByUUID(family.ParentID);
+			if (!parent)
+			{
+				orphans.push_back({enttID, this});
+				continue;
+			}
+
+			const UUID uuid = _registry.get<IDComponent>(enttID).ID;
+			auto& parentFamily = parent.Family();
+			if (!family.PreviousSiblingID)
+			{
+				parentFamily.ChildID = uuid;
+			}
+
+			if (!family.NextSiblingID)
+			{
+				parentFamily.LastChildID = uuid;
+			}
+		}
+
+		// The view iterates the newest entities first.
+		for (auto it = orphans.rbegin(); it != orphans.rend(); ++it)
+		{
+			// Their sibling links are as unusable as their parent, children are kept.
+			auto& family = it->Family();
+			family.ParentID = UUID::Invalid;
+			family.NextSiblingID = UUID::Invalid;
+			family.PreviousSiblingID = UUID::Invalid;
+			ReparentEntity(GetRootEntity(), *it);
+		}
+
+		_isTransformHierarchyDirty = true;
+	}
+
+	void Scene::ReserveEntities(uint32_t count)
+	{
+		_entityMap.reserve(_entityMap.size() + count);
+	}
+
 	void Scene::DestroyEntity(Entity entity)
 	{
 		auto currentEntityID = entity.Family().ChildID;
@@ -171,6 +404,7 @@ namespace Hazel
 		OnEntityDestroy(entity);
 		_entityMap.erase(entity.GetUUID());
 		_registry.destroy(entity);
+		_isTransformHierarchyDirty = true;
 	}
 
 	bool Scene::CheckEntityValidity(const entt::entity entity) const
@@ -181,6 +415,7 @@ namespace Hazel
 	void Scene::OnRuntimeStart()
 	{
 		_isRunning = true;
+		_isStaticGeometryDirty = true;
 
 		OnPhysic2DStart();
 
@@ -231,6 +466,7 @@ namespace Hazel
 		ScriptEngine::OnRuntimeStop();
 
 		_isRunning = false;
+		_staticSpriteBatches.clear();
 	}
 
 	void Scene::OnSimulationStart()
@@ -248,10 +484,17 @@ namespace Hazel
 		if (!_isPaused || _stepFrames-- > 0)
 		{
 			// C# OnUpdate Script
-			for (auto&& [enttID, component] : GetEntitiesViewWith<ScriptComponent>().each())
+			if (ScriptEngine::AreBatchedUpdatesEnabled())
 			{
-				Entity entity = {enttID, this};
-				ScriptEngine::OnUpdateEntity(entity, timestep);
+				ScriptEngine::OnUpdateEntities(timestep);
+			}
+			else
+			{
+				for (auto&& [enttID, component] : GetEntitiesViewWith<ScriptComponent>().each())
+				{
+					Entity entity = {enttID, this};
+					ScriptEngine::OnUpdateEntity(entity, timestep);
+				}
 			}
 
 			for (auto&& [enttID, component] : GetEntitiesViewWith<NativeScriptComponent>().each())
@@ -380,24 +623,13 @@ namespace Hazel
 			return;
 		}
 
-		auto currentChildID = UUID::Invalid;
-		if (newParent)
+		if (newParent && newParent.GetUUID() == newChild.Family().ParentID)
 		{
-			if (newParent.GetUUID() == newChild.Family().ParentID)
-			{
-				return;
-			}
-
-			auto& newParentEntityIDs = newParent.Family();
-
-			currentChildID = newParentEntityIDs.ChildID;
-
-			if (newParent && !currentChildID)
-			{
-				newParentEntityIDs.ChildID = newChild.GetUUID();
-			}
+			return;
 		}
 
+		_isTransformHierarchyDirty = true;
+
 		auto& newChildFamily = newChild.Family();
 		if (const auto newChildPreviousSibling = GetEntityByUUID(newChildFamily.PreviousSiblingID))
 		{
@@ -418,24 +650,32 @@ namespace Hazel
 			{
 				newChildParentIDs.ChildID = newChildFamily.NextSiblingID;
 			}
+
+			if (newChildParentIDs.LastChildID == newChild.GetUUID())
+			{
+				newChildParentIDs.LastChildID = newChildFamily.PreviousSiblingID;
+			}
 		}
 
 		newChildFamily.ParentID = UUID::Invalid;
 		newChildFamily.PreviousSiblingID = UUID::Invalid;
 		newChildFamily.NextSiblingID = UUID::Invalid;
 
-		while (auto newParentChildEntity = GetEntityByUUID(currentChildID))
+		// Append after the last child, the sibling chain is never walked.
+		if (newParent)
 		{
-			auto& newParentChildEntityIDs = newParentChildEntity.Family();
-			if (newParentChildEntityIDs.NextSiblingID)
+			auto& newParentFamily = newParent.Family();
+			if (const auto newParentLastChild = GetEntityByUUID(newParentFamily.LastChildID))
 			{
-				currentChildID = newParentChildEntityIDs.NextSiblingID;
-				continue;
+				newParentLastChild.Family().NextSiblingID = newChild.GetUUID();
+				newChildFamily.PreviousSiblingID = newParentLastChild.GetUUID();
+			}
+			else
+			{
+				newParentFamily.ChildID = newChild.GetUUID();
 			}
 
-			newParentChildEntityIDs.NextSiblingID = newChild.GetUUID();
-			newChildFamily.PreviousSiblingID = newParentChildEntity.GetUUID();
-			break;
+			newParentFamily.LastChildID = newChild.GetUUID();
 		}
 
 		auto& newChildTransform = newChild.Transform();
@@ -521,6 +761,20 @@ namespace Hazel
 		return {};
 	}
 
+	Entity Scene::GetEntityByHandle(entt::entity handle, UUID uuid)
+	{
+		if (uuid != UUID::Invalid && _registry.valid(handle))
+		{
+			Entity entity = {handle, this};
+			if (entity.GetUUID() == uuid)
+			{
+				return entity;
+			}
+		}
+
+		return {};
+	}
+
 	Entity Scene::GetEntityByName(const std::string& name)
 	{
 		for (const auto&& [enttID, component] : GetEntitiesViewWith<BaseComponent>().each())
@@ -647,10 +901,15 @@ namespace Hazel
 
 	void Scene::RenderScene(const glm::vec3& cameraPosition, const glm::vec3& cameraRotation, const glm::mat4& viewProjection)
 	{
+		_renderStats = RenderStatistics();
+
 		if (Renderer2D::BeginScene(viewProjection))
 		{
-			DrawSpriteRenderComponent(cameraPosition);
-			DrawCircleRenderComponent(cameraPosition);
+			UpdateWorldTransforms();
+
+			const Frustum frustum(viewProjection);
+			DrawSpriteRenderComponent(cameraPosition, frustum);
+			DrawCircleRenderComponent(cameraPosition, frustum);
 			DrawTextComponent(cameraPosition);
 			DrawAudioComponent(cameraPosition);
 
@@ -662,30 +921,115 @@ namespace Hazel
 		}
 	}
 
-	void Scene::DrawSpriteRenderComponent(const glm::vec3& cameraPosition)
+	void Scene::InvalidateStaticSprite(Entity entity)
 	{
-		auto entities = GetEntitiesViewWith<SpriteRendererComponent, TransformComponent, FamilyComponent>();
-		//TODO Fix sorting?. Can't have 2 groups sprite and circle render
-		//group.sort<TransformComponent>([&](const auto& lhs, const auto& rhs)
-		//{
-		//	auto lhsDistance = glm::distance(lhs.Position, cameraPosition);
-		//	auto rhsDistance = glm::distance(rhs.Position, cameraPosition);
-		//	return lhsDistance > rhsDistance;
-		//});
-		for (const auto&& [enttID, sprite, transform] : GetEntitiesViewWith<SpriteRendererComponent, TransformComponent>().each())
+		if (entity.Transform().IsInStaticSubtree())
 		{
-			Renderer2D::DrawSprite(transform.GetWorldTransformMatrix(), sprite, static_cast<int>(enttID));
+			_isStaticGeometryDirty = true;
+		}
+	}
+
+	void Scene::UpdateWorldTransforms()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (_isTransformHierarchyDirty)
+		{
+			_transformHierarchy.Rebuild(_registry, _entityMap);
+			_isTransformHierarchyDirty = false;
+			_isStaticGeometryDirty = true;
+		}
+
+		// Physics or scripts may still move a static entity, its batch is baked again.
+		if (_transformHierarchy.Update(true))
+		{
+			_isStaticGeometryDirty = true;
+		}
+	}
+
+	void Scene::BakeStaticGeometry()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		_staticGeometryLoadVersion = AssetManager::GetLoadVersion();
+
+		std::map<int, std::vector<Renderer2D::StaticQuad>> quadsByLayer;
+		for (const auto&& [enttID, sprite, transform, base] : GetEntitiesViewWith<SpriteRendererComponent, TransformComponent, BaseComponent>().each())
+		{
+			if (transform.IsInStaticSubtree())
+			{
+				quadsByLayer[base.Layer].push_back({transform.GetCachedWorldTransformMatrix(), sprite.Color, AssetManager::GetTexture(sprite.TextureHandle), sprite.Tiling, static_cast<int>(enttID)});
+			}
+		}
+
+		_staticSpriteBatches.clear();
+		for (const auto& [layer, quads] : quadsByLayer)
+		{
+			_staticSpriteBatches.push_back({layer, Renderer2D::CreateStaticBatch(quads), static_cast<uint32_t>(quads.size())});
+		}
+
+		_isStaticGeometryDirty = false;
+	}
+
+	void Scene::DrawSpriteRenderComponent(const glm::vec3& cameraPosition, const Frustum& frustum)
+	{
+		// Static sprites are drawn from the batches baked from their world transforms.
+		if (_isRunning)
+		{
+			if (_isStaticGeometryDirty || _staticGeometryLoadVersion != AssetManager::GetLoadVersion())
+			{
+				BakeStaticGeometry();
+			}
+
+			for (const auto& staticBatch : _staticSpriteBatches)
+			{
+				Renderer2D::DrawStaticBatch(staticBatch.Batch, staticBatch.Layer);
+				_renderStats.StaticCount += staticBatch.SpriteCount;
+			}
+		}
+
+		// Renderer2D sorts by layer, translucency and depth at EndScene.
+		for (const auto&& [enttID, sprite, transform, base] : GetEntitiesViewWith<SpriteRendererComponent, TransformComponent, BaseComponent>().each())
+		{
+			if (_isRunning && transform.IsInStaticSubtree())
+			{
+				continue;
+			}
+
+			const glm::mat4& worldTransform = transform.GetCachedWorldTransformMatrix();
+
+			glm::vec3 center, extents;
+			Frustum::GetQuadBounds(worldTransform, center, extents);
+			if (!frustum.IsBoxVisible(center, extents))
+			{
+				_renderStats.CulledCount++;
+				continue;
+			}
+
+			_renderStats.SubmittedCount++;
+			Renderer2D::DrawSprite(worldTransform, sprite, static_cast<int>(enttID), base.Layer);
 
 			// Comment out to draw the sprite bounding box for testing.
 			// Renderer2D::DrawRect(transform.GetTransformMatrix(), Color::Green, (int)entity);
 		}
 	}
 
-	void Scene::DrawCircleRenderComponent(const glm::vec3& cameraPosition)
+	void Scene::DrawCircleRenderComponent(const glm::vec3& cameraPosition, const Frustum& frustum)
 	{
-		for (const auto&& [enttID, circle, transform] : GetEntitiesViewWith<CircleRendererComponent, TransformComponent>().each())
+		for (const auto&& [enttID, circle, transform, base] : GetEntitiesViewWith<CircleRendererComponent, TransformComponent, BaseComponent>().each())
 		{
-			Renderer2D::DrawCircle(transform.GetWorldTransformMatrix(), circle.Color, circle.Thickness, circle.Fade, static_cast<int>(enttID));
+			const glm::mat4& worldTransform = transform.GetCachedWorldTransformMatrix();
+
+			glm::vec3 center, extents;
+			Frustum::GetQuadBounds(worldTransform, center, extents);
+			if (!frustum.IsBoxVisible(center, extents))
+			{
+				_renderStats.CulledCount++;
+				continue;
+			}
+
+			_renderStats.SubmittedCount++;
+			Renderer2D::DrawCircle(worldTransform, circle.Color, circle.Thickness, circle.Fade, static_cast<int>(enttID), base.Layer);
 		}
 	}
 
@@ -771,7 +1115,13 @@ namespace Hazel
 	void Scene::OnComponentAdded<TransformComponent>(Entity entity, TransformComponent& component) {}
 
 	template<>
-	void Scene::OnComponentAdded<SpriteRendererComponent>(Entity entity, SpriteRendererComponent& component) {}
+	void Scene::OnComponentAdded<SpriteRendererComponent>(Entity entity, SpriteRendererComponent& component)
+	{
+		if (entity.Transform().IsInStaticSubtree())
+		{
+			_isStaticGeometryDirty = true;
+		}
+	}
 
 	template<>
 	void Scene::OnComponentAdded<CircleRendererComponent>(Entity entity, CircleRendererComponent& component) {}
@@ -791,6 +1141,9 @@ namespace Hazel
 	template<>
 	void Scene::OnComponentAdded<NativeScriptComponent>(Entity entity, NativeScriptComponent& component) {}
 
+	template<>
+	void Scene::OnComponentAdded<ScriptInstanceComponent>(Entity entity, ScriptInstanceComponent& component) {}
+
 	template<>
 	void Scene::OnComponentAdded<Rigidbody2DComponent>(Entity entity, Rigidbody2DComponent& component) {}
 
@@ -844,7 +1197,13 @@ namespace Hazel
 	void Scene::OnComponentRemoved<TransformComponent>(Entity entity, TransformComponent& component) {}
 
 	template<>
-	void Scene::OnComponentRemoved<SpriteRendererComponent>(Entity entity, SpriteRendererComponent& component) {}
+	void Scene::OnComponentRemoved<SpriteRendererComponent>(Entity entity, SpriteRendererComponent& component)
+	{
+		if (entity.Transform().IsInStaticSubtree())
+		{
+			_isStaticGeometryDirty = true;
+		}
+	}
 
 	template<>
 	void Scene::OnComponentRemoved<CircleRendererComponent>(Entity entity, CircleRendererComponent& component) {}
@@ -864,6 +1223,9 @@ namespace Hazel
 	template<>
 	void Scene::OnComponentRemoved<NativeScriptComponent>(Entity entity, NativeScriptComponent& component) {}
 
+	template<>
+	void Scene::OnComponentRemoved<ScriptInstanceComponent>(Entity entity, ScriptInstanceComponent& component) {}
+
 	template<>
 	void Scene::OnComponentRemoved<Rigidbody2DComponent>(Entity entity, Rigidbody2DComponent& component) {}
 
@@ -1,9 +1,13 @@
 #pragma once
 #include "Hazel/Core/Timestep.h"
 #include "Hazel/Core/UUID.h"
+#include "Hazel/Math/Frustum.h"
 #include "Hazel/Renderer/EditorCamera.h"
+#include "Hazel/Renderer/Renderer2D.h"
 #include "Hazel/Renderer/Texture.h"
 #include "Hazel/Scene/Components.h"
+#include "Hazel/Scene/TransformHierarchy.h"
+#include "Hazel/Scripting/ScriptField.h"
 
 #include "entt.hpp"
 
@@ -15,6 +19,15 @@ namespace Hazel
 
 	class Scene
 	{
+	public:
+		// Sprites and circles of the last RenderScene, culled ones were outside the camera frustum.
+		struct RenderStatistics
+		{
+			uint32_t SubmittedCount = 0;
+			uint32_t CulledCount = 0;
+			uint32_t StaticCount = 0; // Sprites drawn from the baked static batches, never culled.
+		};
+
 	public:
 		Scene();
 		Scene(const std::string& name);
@@ -22,8 +35,31 @@ namespace Hazel
 
 		static Ref<Scene> Copy(const Ref<Scene>& other);
 
+		// Named in-memory save states: the component pools are cloned and the script fields captured, live values while running.
+		// Restoring replaces the scene content in place, a running scene is restarted on the restored entities.
+		void SaveSnapshot(const std::string& name);
+		bool RestoreSnapshot(const std::string& name);
+		bool HasSnapshot(const std::string& name) const { return _snapshots.find(name) != _snapshots.end(); }
+		void DeleteSnapshot(const std::string& name) { _snapshots.erase(name); }
+
 		Entity CreateEntity(const std::string& name = "Entity", int tag = 0, int layer = 0);
 		Entity CreateEntityWithUUID(UUID uuid, const std::string& name = "Entity", int tag = 0, int layer = 0);
+		// For bulk construction, the entity is not part of the hierarchy until LinkFamilies is called.
+		Entity CreateUnlinkedEntityWithUUID(UUID uuid, const std::string& name = "Entity", int tag = 0, int layer = 0);
+		// Same as CreateUnlinkedEntityWithUUID for count entities at once, their handles are written to entities in order.
+		// Their transforms are copied from transforms when given.
+		void CreateUnlinkedEntities(const uint64_t* uuids, uint32_t count, entt::entity* entities, const TransformComponent* transforms = nullptr);
+		// For bulk construction, components[i] is copied to entities[i] in a single insert into the pool.
+		// OnComponentAdded is not called, only for components without a hook the added component depends on.
+		template<typename T>
+		void InsertComponents(const entt::entity* entities, uint32_t count, const T* components)
+		{
+			_registry.insert<T>(entities, entities + count, components);
+		}
+		// Derives the first and last child of every parent from the sibling links of its children,
+		// entities without a valid parent are appended to the root in creation order.
+		void LinkFamilies();
+		void ReserveEntities(uint32_t count);
 		void DestroyEntity(Entity entity);
 		bool CheckEntityValidity(entt::entity entity) const;
 
@@ -44,6 +80,8 @@ namespace Hazel
 
 		Entity DuplicateEntity(Entity entity);
 		Entity GetEntityByUUID(UUID uuid);
+		// Direct registry index, the UUID only rejects a handle recycled by another entity.
+		Entity GetEntityByHandle(entt::entity handle, UUID uuid);
 		Entity GetEntityByName(const std::string& name);
 
 		Entity GetPrimaryCameraEntity();
@@ -66,6 +104,14 @@ namespace Hazel
 
 		glm::ivec2 GetViewportSize() const { return {_viewportWidth, _viewportHeight}; }
 
+		const RenderStatistics& GetRenderStats() const { return _renderStats; }
+
+		// Static transforms and sprites are baked while running, call when one of them was edited.
+		void InvalidateStaticGeometry() { _isTransformHierarchyDirty = true; }
+		// Call after editing the SpriteRendererComponent of an entity at runtime, static sprites are drawn from their baked values.
+		// Moved static transforms are noticed by the scene without it.
+		void InvalidateStaticSprite(Entity entity);
+
 		bool GetShouldUpdatePhysics() const { return _shouldUpdatePhysics; }
 		void SetShouldUpdatePhysics(const bool shouldUpdatePhysics) { _shouldUpdatePhysics = shouldUpdatePhysics; }
 
@@ -80,11 +126,14 @@ namespace Hazel
 		void OnPhysic2DStart();
 		void OnPhysic2DStop();
 
+		void UpdateWorldTransforms();
+		void BakeStaticGeometry();
+
 		void RenderScene(const EditorCamera& camera);
 		void RenderScene(const glm::vec3& cameraPosition, const glm::vec3& cameraRotation, const glm::mat4& viewProjection);
 
-		void DrawSpriteRenderComponent(const glm::vec3& cameraPosition);
-		void DrawCircleRenderComponent(const glm::vec3& cameraPosition);
+		void DrawSpriteRenderComponent(const glm::vec3& cameraPosition, const Frustum& frustum);
+		void DrawCircleRenderComponent(const glm::vec3& cameraPosition, const Frustum& frustum);
 		void DrawTextComponent(const glm::vec3& cameraPosition);
 		void DrawAudioComponent(const glm::vec3& cameraPosition);
 
@@ -107,6 +156,30 @@ namespace Hazel
 		b2World* _physicsWorld = nullptr;
 		bool _shouldUpdatePhysics = true;
 
+		RenderStatistics _renderStats;
+
+		TransformHierarchy _transformHierarchy;
+		bool _isTransformHierarchyDirty = true; // Entities were created, destroyed or reparented.
+
+		struct StaticSpriteBatch
+		{
+			int Layer = 0;
+			Ref<Renderer2D::StaticBatch> Batch;
+			uint32_t SpriteCount = 0;
+		};
+		std::vector<StaticSpriteBatch> _staticSpriteBatches;
+		bool _isStaticGeometryDirty = true;
+		uint64_t _staticGeometryLoadVersion = 0; // Textures loaded since baking replace placeholders in the batches.
+
+		struct Snapshot
+		{
+			entt::registry Registry;
+			entt::entity RootEntt = entt::null;
+			std::unordered_map<UUID, entt::entity> EntityMap;
+			std::unordered_map<UUID, ScriptFieldMap> ScriptFields;
+		};
+		std::unordered_map<std::string, Scope<Snapshot>> _snapshots;
+
 	private:
 		static Ref<Texture2D> _sAudioSourceIcon;
 		static Ref<Texture2D> _sAudioListenerIcon;
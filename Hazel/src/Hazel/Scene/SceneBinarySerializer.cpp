@@ -0,0 +1,1104 @@
+#include "hzpch.h"
+#include "SceneBinarySerializer.h"
+
+#include "Entity.h"
+#include "Components.h"
+#include "SceneSerializer.h"
+
+#include "Hazel/Audio/AudioEngine.h"
+#include "Hazel/Core/MappedFile.h"
+#include "Hazel/Core/Timer.h"
+#include "Hazel/Project/Project.h"
+#include "Hazel/Scripting/ScriptEngine.h"
+#include "Hazel/Scripting/ScriptClass.h"
+
+#include <span>
+
+namespace Hazel
+{
+	// Layout, every section starts on a kSectionAlignment boundary:
+	// FileHeader | BlockEntry[BlockCount] | UUID index | component blocks | string table
+	// Base, Family and Transform blocks hold one record per entity in UUID index order,
+	// the other blocks one record per component which references its entity by index.
+	static constexpr char kMagic[4] = {'H', 'Z', 'S', 'B'};
+	static constexpr uint32_t kVersion = 1;
+	static constexpr uint64_t kSectionAlignment = 16;
+
+	static std::vector<uint8_t> _runtimeSceneData;
+
+	namespace Binary
+	{
+		enum class BlockType : uint32_t
+		{
+			Base = 0,
+			Family,
+			Transform,
+			Camera,
+			Script,
+			ScriptField,
+			SpriteRenderer,
+			CircleRenderer,
+			Text,
+			Rigidbody2D,
+			BoxCollider2D,
+			CircleCollider2D,
+			AudioSource,
+			AudioListener
+		};
+
+		// Offset and length into the string table, empty strings have a length of 0.
+		struct StringRef
+		{
+			uint32_t Offset = 0;
+			uint32_t Length = 0;
+		};
+
+		struct FileHeader
+		{
+			char Magic[4];
+			uint32_t Version;
+			uint32_t EntityCount;
+			uint32_t BlockCount;
+			StringRef SceneName;
+			uint64_t RootEntityChildID;
+			uint64_t BlockTableOffset;
+			uint64_t UUIDIndexOffset;
+			uint64_t StringTableOffset;
+			uint64_t StringTableSize;
+		};
+		static_assert(sizeof(FileHeader) == 64);
+
+		struct BlockEntry
+		{
+			BlockType Type;
+			uint32_t Count;
+			uint32_t Stride;
+			uint32_t Padding;
+			uint64_t Offset;
+		};
+		static_assert(sizeof(BlockEntry) == 24);
+
+		// Records have explicit padding so the written bytes never depend on the compiler.
+#pragma region Records
+		struct BaseRecord
+		{
+			static constexpr BlockType Type = BlockType::Base;
+
+			StringRef Name;
+			int32_t Tag;
+			int32_t Layer;
+		};
+		static_assert(sizeof(BaseRecord) == 16);
+
+		struct FamilyRecord
+		{
+			static constexpr BlockType Type = BlockType::Family;
+
+			uint64_t ParentID;
+			uint64_t ChildID;
+			uint64_t NextSiblingID;
+			uint64_t PreviousSiblingID;
+		};
+		static_assert(sizeof(FamilyRecord) == 32);
+
+		struct TransformRecord
+		{
+			static constexpr BlockType Type = BlockType::Transform;
+
+			glm::vec3 Position;
+			glm::vec3 Rotation;
+			glm::vec3 Scale;
+			uint8_t Mobility;
+			uint8_t Padding[3];
+		};
+		static_assert(sizeof(TransformRecord) == 40);
+
+		struct CameraRecord
+		{
+			static constexpr BlockType Type = BlockType::Camera;
+
+			uint32_t EntityIndex;
+			uint32_t ProjectionType;
+			float PerspectiveVerticalFOV;
+			float PerspectiveNearClip;
+			float PerspectiveFarClip;
+			float OrthographicSize;
+			float OrthographicNearClip;
+			float OrthographicFarClip;
+			float AspectRatio;
+			uint8_t IsPrimary;
+			uint8_t IsFixedAspectRatio;
+			uint8_t Padding[2];
+		};
+		static_assert(sizeof(CameraRecord) == 40);
+
+		// The fields of a script are the FieldCount records starting at FirstField in the ScriptField block.
+		struct ScriptRecord
+		{
+			static constexpr BlockType Type = BlockType::Script;
+
+			uint32_t EntityIndex;
+			StringRef ClassName;
+			uint32_t FirstField;
+			uint32_t FieldCount;
+		};
+		static_assert(sizeof(ScriptRecord) == 20);
+
+		struct ScriptFieldRecord
+		{
+			static constexpr BlockType Type = BlockType::ScriptField;
+
+			StringRef Name;
+			uint32_t FieldType;
+			uint32_t Padding;
+			uint8_t Data[16]; // Raw value of every type but String.
+			StringRef String;
+		};
+		static_assert(sizeof(ScriptFieldRecord) == 40);
+
+		struct SpriteRendererRecord
+		{
+			static constexpr BlockType Type = BlockType::SpriteRenderer;
+
+			uint32_t EntityIndex;
+			StringRef TexturePath;
+			uint32_t MagFilter;
+			glm::vec2 Tiling;
+			glm::vec4 Color;
+		};
+		static_assert(sizeof(SpriteRendererRecord) == 40);
+
+		struct CircleRendererRecord
+		{
+			static constexpr BlockType Type = BlockType::CircleRenderer;
+
+			uint32_t EntityIndex;
+			glm::vec4 Color;
+			float Thickness;
+			float Fade;
+		};
+		static_assert(sizeof(CircleRendererRecord) == 28);
+
+		struct TextRecord
+		{
+			static constexpr BlockType Type = BlockType::Text;
+
+			uint32_t EntityIndex;
+			StringRef Text;
+			glm::vec4 Color;
+			float Kerning;
+			float LineSpace;
+		};
+		static_assert(sizeof(TextRecord) == 36);
+
+		struct Rigidbody2DRecord
+		{
+			static constexpr BlockType Type = BlockType::Rigidbody2D;
+
+			uint32_t EntityIndex;
+			uint32_t BodyType;
+			uint8_t IsFixedRotation;
+			uint8_t Padding[3];
+		};
+		static_assert(sizeof(Rigidbody2DRecord) == 12);
+
+		struct BoxCollider2DRecord
+		{
+			static constexpr BlockType Type = BlockType::BoxCollider2D;
+
+			uint32_t EntityIndex;
+			glm::vec2 Offset;
+			glm::vec2 Size;
+			float Rotation;
+			float Density;
+			float Friction;
+			float Restitution;
+			float RestitutionThreshold;
+		};
+		static_assert(sizeof(BoxCollider2DRecord) == 40);
+
+		struct CircleCollider2DRecord
+		{
+			static constexpr BlockType Type = BlockType::CircleCollider2D;
+
+			uint32_t EntityIndex;
+			glm::vec2 Offset;
+			float Radius;
+			float Density;
+			float Friction;
+			float Restitution;
+			float RestitutionThreshold;
+		};
+		static_assert(sizeof(CircleCollider2DRecord) == 32);
+
+		// An empty ClipPath means the component has no audio source.
+		struct AudioSourceRecord
+		{
+			static constexpr BlockType Type = BlockType::AudioSource;
+
+			uint32_t EntityIndex;
+			StringRef ClipPath;
+			float Gain;
+			float Pitch;
+			uint8_t IsAutoPlay;
+			uint8_t IsVisibleInGame;
+			uint8_t IsLoop;
+			uint8_t Is3D;
+		};
+		static_assert(sizeof(AudioSourceRecord) == 24);
+
+		struct AudioListenerRecord
+		{
+			static constexpr BlockType Type = BlockType::AudioListener;
+
+			uint32_t EntityIndex;
+			uint8_t IsVisibleInGame;
+			uint8_t Padding[3];
+		};
+		static_assert(sizeof(AudioListenerRecord) == 8);
+#pragma endregion
+
+		// ScriptFieldInstance values are copied as raw bytes, whatever their type.
+		struct ScriptFieldData
+		{
+			uint8_t Bytes[16];
+		};
+
+		static uint64_t AlignUp(uint64_t offset)
+		{
+			return (offset + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+		}
+
+		// Identical strings, like the texture path of many sprites, are stored once.
+		class StringTableBuilder
+		{
+		public:
+			StringRef Add(const std::string& string)
+			{
+				if (string.empty())
+				{
+					return {};
+				}
+
+				const auto [it, isInserted] = _refs.try_emplace(string);
+				if (isInserted)
+				{
+					it->second = {static_cast<uint32_t>(_data.size()), static_cast<uint32_t>(string.size())};
+					_data.append(string);
+				}
+
+				return it->second;
+			}
+
+			const std::string& GetData() const { return _data; }
+
+		private:
+			std::string _data;
+			std::unordered_map<std::string, StringRef> _refs;
+		};
+
+		// Validated view over serialized data, records are read in place.
+		class FileView
+		{
+		public:
+			bool Open(const uint8_t* data, uint64_t size)
+			{
+				_data = data;
+				_size = size;
+
+				if (size < sizeof(FileHeader) || memcmp(data, kMagic, sizeof(kMagic)) != 0)
+				{
+					HZ_CORE_LERROR("Scene deserialization failed. Not a binary scene.");
+					return false;
+				}
+
+				_header = reinterpret_cast<const FileHeader*>(data);
+				if (_header->Version != kVersion)
+				{
+					HZ_CORE_LERROR("Scene deserialization failed. Unsupported binary scene version {0}.", _header->Version);
+					return false;
+				}
+
+				if (!IsInRange(_header->BlockTableOffset, static_cast<uint64_t>(_header->BlockCount) * sizeof(BlockEntry))
+					|| !IsInRange(_header->UUIDIndexOffset, static_cast<uint64_t>(_header->EntityCount) * sizeof(uint64_t))
+					|| !IsInRange(_header->StringTableOffset, _header->StringTableSize))
+				{
+					HZ_CORE_LERROR("Scene deserialization failed. Truncated binary scene.");
+					return false;
+				}
+
+				_blocks = std::span(reinterpret_cast<const BlockEntry*>(data + _header->BlockTableOffset), _header->BlockCount);
+				for (const auto& block : _blocks)
+				{
+					if (block.Offset % kSectionAlignment != 0 || !IsInRange(block.Offset, static_cast<uint64_t>(block.Count) * block.Stride))
+					{
+						HZ_CORE_LERROR("Scene deserialization failed. Invalid component block.");
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			const FileHeader& GetHeader() const { return *_header; }
+			const uint64_t* GetUUIDs() const { return reinterpret_cast<const uint64_t*>(_data + _header->UUIDIndexOffset); }
+
+			std::string GetString(const StringRef ref) const
+			{
+				if (!IsInRange(ref.Offset, ref.Length, _header->StringTableSize))
+				{
+					return {};
+				}
+
+				return {reinterpret_cast<const char*>(_data + _header->StringTableOffset + ref.Offset), ref.Length};
+			}
+
+			// A missing block is empty, one written with another record layout is an error.
+			template<typename Record>
+			bool GetBlock(std::span<const Record>& records) const
+			{
+				records = {};
+				for (const auto& block : _blocks)
+				{
+					if (block.Type != Record::Type)
+					{
+						continue;
+					}
+
+					if (block.Stride != sizeof(Record))
+					{
+						HZ_CORE_LERROR("Scene deserialization failed. Component block {0} has a stride of {1} instead of {2}.", static_cast<uint32_t>(block.Type), block.Stride, sizeof(Record));
+						return false;
+					}
+
+					records = std::span(reinterpret_cast<const Record*>(_data + block.Offset), block.Count);
+				}
+
+				return true;
+			}
+
+		private:
+			bool IsInRange(uint64_t offset, uint64_t size) const
+			{
+				return IsInRange(offset, size, _size);
+			}
+
+			static bool IsInRange(uint64_t offset, uint64_t size, uint64_t totalSize)
+			{
+				return offset <= totalSize && size <= totalSize - offset;
+			}
+
+		private:
+			const uint8_t* _data = nullptr;
+			uint64_t _size = 0;
+			const FileHeader* _header = nullptr;
+			std::span<const BlockEntry> _blocks;
+		};
+
+		template<typename Record>
+		static bool HasValidEntityIndices(const std::span<const Record> records, const uint32_t entityCount)
+		{
+			return std::all_of(records.begin(), records.end(), [entityCount](const Record& record) { return record.EntityIndex < entityCount; });
+		}
+	}
+
+	SceneBinarySerializer::SceneBinarySerializer(const Ref<Scene>& scene)
+		: _scene(scene) {}
+
+	void SceneBinarySerializer::Serialize(const std::filesystem::path& filepath)
+	{
+		_scene->SetName(filepath.filename().replace_extension().string());
+
+		const auto data = SerializeData();
+
+		std::ofstream fout(filepath, std::ios::binary);
+		fout.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+	}
+
+	void SceneBinarySerializer::SerializeRuntime()
+	{
+		_runtimeSceneData = SerializeData();
+	}
+
+	std::vector<uint8_t> SceneBinarySerializer::SerializeData() const
+	{
+		HZ_PROFILE_FUNCTION();
+
+		Binary::StringTableBuilder strings;
+
+		Binary::FileHeader header{};
+		memcpy(header.Magic, kMagic, sizeof(kMagic));
+		header.Version = kVersion;
+		header.SceneName = strings.Add(_scene->GetName());
+		header.RootEntityChildID = _scene->GetRootEntity().Family().ChildID;
+
+		std::vector<uint64_t> uuids;
+		std::vector<Binary::BaseRecord> bases;
+		std::vector<Binary::FamilyRecord> families;
+		std::vector<Binary::TransformRecord> transforms;
+		std::vector<Binary::CameraRecord> cameras;
+		std::vector<Binary::ScriptRecord> scripts;
+		std::vector<Binary::ScriptFieldRecord> scriptFields;
+		std::vector<Binary::SpriteRendererRecord> spriteRenderers;
+		std::vector<Binary::CircleRendererRecord> circleRenderers;
+		std::vector<Binary::TextRecord> texts;
+		std::vector<Binary::Rigidbody2DRecord> rigidbodies;
+		std::vector<Binary::BoxCollider2DRecord> boxColliders;
+		std::vector<Binary::CircleCollider2DRecord> circleColliders;
+		std::vector<Binary::AudioSourceRecord> audioSources;
+		std::vector<Binary::AudioListenerRecord> audioListeners;
+
+		// Same order as the YAML serializer.
+		const auto entities = _scene->GetEntitiesGroupWith<IDComponent>();
+		uuids.reserve(entities.size());
+		bases.reserve(entities.size());
+		families.reserve(entities.size());
+		transforms.reserve(entities.size());
+		for (int i = static_cast<int>(entities.size()) - 1; i >= 0; i--)
+		{
+			const Entity entity{entities[i], _scene.get()};
+			const auto entityIndex = static_cast<uint32_t>(uuids.size());
+
+			uuids.push_back(entity.GetUUID());
+
+#pragma region Basics
+			{
+				const auto& component = entity.GetComponent<BaseComponent>();
+				bases.push_back({strings.Add(component.Name), component.Tag, component.Layer});
+			}
+
+			{
+				const auto& component = entity.Family();
+				families.push_back({component.ParentID, component.ChildID, component.NextSiblingID, component.PreviousSiblingID});
+			}
+
+			{
+				const auto& component = entity.Transform();
+				auto& record = transforms.emplace_back();
+				record.Position = component.Position;
+				record.Rotation = component.Rotation;
+				record.Scale = component.Scale;
+				record.Mobility = static_cast<uint8_t>(component.Mobility);
+			}
+#pragma endregion
+
+#pragma region CameraComponent
+			if (entity.HasComponent<CameraComponent>())
+			{
+				const auto& component = entity.GetComponent<CameraComponent>();
+				const auto& camera = component.Camera;
+
+				auto& record = cameras.emplace_back();
+				record.EntityIndex = entityIndex;
+				record.ProjectionType = static_cast<uint32_t>(camera.GetProjectionType());
+				record.PerspectiveVerticalFOV = camera.GetPerspectiveVerticalFOV();
+				record.PerspectiveNearClip = camera.GetPerspectiveNearClip();
+				record.PerspectiveFarClip = camera.GetPerspectiveFarClip();
+				record.OrthographicSize = camera.GetOrthographicSize();
+				record.OrthographicNearClip = camera.GetOrthographicNearClip();
+				record.OrthographicFarClip = camera.GetOrthographicFarClip();
+				record.AspectRatio = camera.GetAspectRatio();
+				record.IsPrimary = component.IsPrimary;
+				record.IsFixedAspectRatio = component.IsFixedAspectRatio;
+			}
+#pragma endregion
+
+#pragma region ScriptComponent
+			if (entity.HasComponent<ScriptComponent>())
+			{
+				const auto& component = entity.GetComponent<ScriptComponent>();
+
+				auto& record = scripts.emplace_back();
+				record.EntityIndex = entityIndex;
+				record.ClassName = strings.Add(component.ClassName);
+				record.FirstField = static_cast<uint32_t>(scriptFields.size());
+
+				if (auto entityClass = ScriptEngine::GetEntityClass(component.ClassName))
+				{
+					auto& entityFields = ScriptEngine::GetScriptFieldMap(entity);
+
+					for (const auto& [name, field] : entityClass->GetFields())
+					{
+						const auto it = entityFields.find(name);
+						if (it == entityFields.end())
+						{
+							continue;
+						}
+
+						auto& fieldRecord = scriptFields.emplace_back();
+						fieldRecord.Name = strings.Add(name);
+						fieldRecord.FieldType = static_cast<uint32_t>(field.Type);
+						if (field.Type == ScriptFieldType::String)
+						{
+							fieldRecord.String = strings.Add(it->second.GetStringValue());
+						}
+						else
+						{
+							memcpy(fieldRecord.Data, it->second.GetValue<Binary::ScriptFieldData>().Bytes, sizeof(fieldRecord.Data));
+						}
+					}
+				}
+
+				record.FieldCount = static_cast<uint32_t>(scriptFields.size()) - record.FirstField;
+			}
+#pragma endregion
+
+#pragma region SpriteRendererComponent
+			if (entity.HasComponent<SpriteRendererComponent>())
+			{
+				const auto& component = entity.GetComponent<SpriteRendererComponent>();
+
+				auto& record = spriteRenderers.emplace_back();
+				record.EntityIndex = entityIndex;
+				if (component.TextureHandle != UUID::Invalid)
+				{
+					const auto path = std::filesystem::relative(AssetManager::GetAssetPath(component.TextureHandle), Project::GetAssetDirectory());
+					record.TexturePath = strings.Add(path.string());
+					record.MagFilter = AssetManager::GetTextureMagFilter(component.TextureHandle);
+				}
+				record.Tiling = component.Tiling;
+				record.Color = component.Color;
+			}
+#pragma endregion
+
+#pragma region CircleRendererComponent
+			if (entity.HasComponent<CircleRendererComponent>())
+			{
+				const auto& component = entity.GetComponent<CircleRendererComponent>();
+				circleRenderers.push_back({entityIndex, component.Color, component.Thickness, component.Fade});
+			}
+#pragma endregion
+
+#pragma region TextComponent
+			if (entity.HasComponent<TextComponent>())
+			{
+				// TODO FontAsset
+				const auto& component = entity.GetComponent<TextComponent>();
+				texts.push_back({entityIndex, strings.Add(component.Text), component.Color, component.Kerning, component.LineSpace});
+			}
+#pragma endregion
+
+#pragma region Rigidbody2DComponent
+			if (entity.HasComponent<Rigidbody2DComponent>())
+			{
+				const auto& component = entity.GetComponent<Rigidbody2DComponent>();
+
+				auto& record = rigidbodies.emplace_back();
+				record.EntityIndex = entityIndex;
+				record.BodyType = static_cast<uint32_t>(component.Type);
+				record.IsFixedRotation = component.IsFixedRotation;
+			}
+#pragma endregion
+
+#pragma region BoxCollider2DComponent
+			if (entity.HasComponent<BoxCollider2DComponent>())
+			{
+				const auto& component = entity.GetComponent<BoxCollider2DComponent>();
+				boxColliders.push_back({entityIndex, component.Offset, component.Size, component.Rotation, component.Density, component.Friction, component.Restitution, component.RestitutionThreshold});
+			}
+#pragma endregion
+
+#pragma region CircleCollider2DComponent
+			if (entity.HasComponent<CircleCollider2DComponent>())
+			{
+				const auto& component = entity.GetComponent<CircleCollider2DComponent>();
+				circleColliders.push_back({entityIndex, component.Offset, component.Radius, component.Density, component.Friction, component.Restitution, component.RestitutionThreshold});
+			}
+#pragma endregion
+
+#pragma region AudioSourceComponent
+			if (entity.HasComponent<AudioSourceComponent>())
+			{
+				const auto& component = entity.GetComponent<AudioSourceComponent>();
+
+				auto& record = audioSources.emplace_back();
+				record.EntityIndex = entityIndex;
+				record.IsAutoPlay = component.IsAutoPlay;
+				record.IsVisibleInGame = component.IsVisibleInGame;
+				record.Gain = 1.0f;
+				record.Pitch = 1.0f;
+				if (component.AudioSource != nullptr)
+				{
+					record.ClipPath = strings.Add(component.AudioSource->GetPath().string()); // TODO not use path but actual audio asset.
+					record.Gain = component.AudioSource->GetGain();
+					record.Pitch = component.AudioSource->GetPitch();
+					record.IsLoop = component.AudioSource->GetLoop();
+					record.Is3D = component.AudioSource->Get3D();
+				}
+			}
+#pragma endregion
+
+#pragma region AudioListenerComponent
+			if (entity.HasComponent<AudioListenerComponent>())
+			{
+				const auto& component = entity.GetComponent<AudioListenerComponent>();
+
+				auto& record = audioListeners.emplace_back();
+				record.EntityIndex = entityIndex;
+				record.IsVisibleInGame = component.IsVisibleInGame;
+			}
+#pragma endregion
+		}
+
+		struct PendingBlock
+		{
+			Binary::BlockEntry Entry;
+			const void* Data;
+		};
+
+		std::vector<PendingBlock> blocks;
+		auto addBlock = [&blocks]<typename Record>(const std::vector<Record>& records)
+		{
+			if (!records.empty())
+			{
+				blocks.push_back({{Record::Type, static_cast<uint32_t>(records.size()), sizeof(Record)}, records.data()});
+			}
+		};
+
+		addBlock(bases);
+		addBlock(families);
+		addBlock(transforms);
+		addBlock(cameras);
+		addBlock(scripts);
+		addBlock(scriptFields);
+		addBlock(spriteRenderers);
+		addBlock(circleRenderers);
+		addBlock(texts);
+		addBlock(rigidbodies);
+		addBlock(boxColliders);
+		addBlock(circleColliders);
+		addBlock(audioSources);
+		addBlock(audioListeners);
+
+		header.EntityCount = static_cast<uint32_t>(uuids.size());
+		header.BlockCount = static_cast<uint32_t>(blocks.size());
+
+		uint64_t offset = Binary::AlignUp(sizeof(Binary::FileHeader));
+		header.BlockTableOffset = offset;
+		offset = Binary::AlignUp(offset + blocks.size() * sizeof(Binary::BlockEntry));
+		header.UUIDIndexOffset = offset;
+		offset = Binary::AlignUp(offset + uuids.size() * sizeof(uint64_t));
+		for (auto& block : blocks)
+		{
+			block.Entry.Offset = offset;
+			offset = Binary::AlignUp(offset + static_cast<uint64_t>(block.Entry.Count) * block.Entry.Stride);
+		}
+		header.StringTableOffset = offset;
+		header.StringTableSize = strings.GetData().size();
+
+		// Zero filled, the alignment gaps are deterministic.
+		std::vector<uint8_t> data(header.StringTableOffset + header.StringTableSize);
+		memcpy(data.data(), &header, sizeof(header));
+		for (size_t i = 0; i < blocks.size(); i++)
+		{
+			memcpy(data.data() + header.BlockTableOffset + i * sizeof(Binary::BlockEntry), &blocks[i].Entry, sizeof(Binary::BlockEntry));
+			memcpy(data.data() + blocks[i].Entry.Offset, blocks[i].Data, static_cast<size_t>(blocks[i].Entry.Count) * blocks[i].Entry.Stride);
+		}
+		memcpy(data.data() + header.UUIDIndexOffset, uuids.data(), uuids.size() * sizeof(uint64_t));
+		memcpy(data.data() + header.StringTableOffset, strings.GetData().data(), strings.GetData().size());
+
+		return data;
+	}
+
+	bool SceneBinarySerializer::Deserialize(const std::filesystem::path& filepath, const bool isWithLog)
+	{
+		const MappedFile file(filepath);
+		if (!file)
+		{
+			HZ_CORE_LERROR("Scene deserialization failed. Could not map '{0}'", filepath);
+			return false;
+		}
+
+		return DeserializeData(file.GetData(), file.GetSize(), isWithLog);
+	}
+
+	bool SceneBinarySerializer::DeserializeRuntime()
+	{
+		return DeserializeData(_runtimeSceneData.data(), _runtimeSceneData.size(), false);
+	}
+
+	bool SceneBinarySerializer::DeserializeData(const uint8_t* data, uint64_t size, bool isWithLog) const
+	{
+		HZ_PROFILE_FUNCTION();
+
+		Binary::FileView file;
+		if (!file.Open(data, size))
+		{
+			return false;
+		}
+
+		std::span<const Binary::BaseRecord> bases;
+		std::span<const Binary::FamilyRecord> families;
+		std::span<const Binary::TransformRecord> transforms;
+		std::span<const Binary::CameraRecord> cameras;
+		std::span<const Binary::ScriptRecord> scripts;
+		std::span<const Binary::ScriptFieldRecord> scriptFields;
+		std::span<const Binary::SpriteRendererRecord> spriteRenderers;
+		std::span<const Binary::CircleRendererRecord> circleRenderers;
+		std::span<const Binary::TextRecord> texts;
+		std::span<const Binary::Rigidbody2DRecord> rigidbodies;
+		std::span<const Binary::BoxCollider2DRecord> boxColliders;
+		std::span<const Binary::CircleCollider2DRecord> circleColliders;
+		std::span<const Binary::AudioSourceRecord> audioSources;
+		std::span<const Binary::AudioListenerRecord> audioListeners;
+		if (!file.GetBlock(bases) || !file.GetBlock(families) || !file.GetBlock(transforms) || !file.GetBlock(cameras)
+			|| !file.GetBlock(scripts) || !file.GetBlock(scriptFields) || !file.GetBlock(spriteRenderers) || !file.GetBlock(circleRenderers)
+			|| !file.GetBlock(texts) || !file.GetBlock(rigidbodies) || !file.GetBlock(boxColliders) || !file.GetBlock(circleColliders)
+			|| !file.GetBlock(audioSources) || !file.GetBlock(audioListeners))
+		{
+			return false;
+		}
+
+		const uint32_t entityCount = file.GetHeader().EntityCount;
+		const bool areRecordsValid = bases.size() == entityCount && families.size() == entityCount && transforms.size() == entityCount
+			&& Binary::HasValidEntityIndices(cameras, entityCount) && Binary::HasValidEntityIndices(scripts, entityCount)
+			&& Binary::HasValidEntityIndices(spriteRenderers, entityCount) && Binary::HasValidEntityIndices(circleRenderers, entityCount)
+			&& Binary::HasValidEntityIndices(texts, entityCount) && Binary::HasValidEntityIndices(rigidbodies, entityCount)
+			&& Binary::HasValidEntityIndices(boxColliders, entityCount) && Binary::HasValidEntityIndices(circleColliders, entityCount)
+			&& Binary::HasValidEntityIndices(audioSources, entityCount) && Binary::HasValidEntityIndices(audioListeners, entityCount)
+			&& std::all_of(scripts.begin(), scripts.end(), [&scriptFields](const Binary::ScriptRecord& record)
+			{
+				return static_cast<uint64_t>(record.FirstField) + record.FieldCount <= scriptFields.size();
+			});
+
+		if (!areRecordsValid)
+		{
+			HZ_CORE_LERROR("Scene deserialization failed. Component records reference missing entities.");
+			return false;
+		}
+
+		const auto sceneName = file.GetString(file.GetHeader().SceneName);
+		if (isWithLog)
+		{
+			HZ_CORE_LTRACE("Deserializing scene name[{0}]", sceneName);
+		}
+
+		_scene->SetName(sceneName);
+
+		// Transforms go into the pool with their values instead of being written entity by entity afterwards.
+		std::vector<TransformComponent> transformComponents(entityCount);
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto& transform = transformComponents[i];
+			transform.Position = transforms[i].Position;
+			transform.Rotation = transforms[i].Rotation;
+			transform.Scale = transforms[i].Scale;
+			transform.Mobility = transforms[i].Mobility == static_cast<uint8_t>(TransformMobility::Static) ? TransformMobility::Static : TransformMobility::Dynamic;
+		}
+
+		std::vector<entt::entity> entities(entityCount);
+		_scene->CreateUnlinkedEntities(file.GetUUIDs(), entityCount, entities.data(), transformComponents.data());
+
+		auto getEntity = [&](const uint32_t entityIndex) { return Entity{entities[entityIndex], _scene.get()}; };
+
+		// Builds the components of a block from its records and inserts them into their pool at once.
+		auto insertComponents = [&]<typename Record, typename MakeComponent>(std::span<const Record> records, MakeComponent makeComponent)
+		{
+			using Component = std::invoke_result_t<MakeComponent, const Record&>;
+
+			std::vector<entt::entity> owners;
+			std::vector<Component> components;
+			owners.reserve(records.size());
+			components.reserve(records.size());
+			for (const auto& record : records)
+			{
+				owners.push_back(entities[record.EntityIndex]);
+				components.push_back(makeComponent(record));
+			}
+
+			_scene->InsertComponents(owners.data(), static_cast<uint32_t>(owners.size()), components.data());
+		};
+
+#pragma region Basics
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			const Entity entity = getEntity(i);
+
+			auto& base = entity.GetComponent<BaseComponent>();
+			base.Name = file.GetString(bases[i].Name);
+			base.Tag = bases[i].Tag;
+			base.Layer = bases[i].Layer;
+
+			if (isWithLog)
+			{
+				HZ_CORE_LTRACE(" Entity: ID[{0}], Name[{1}],Tag[{2}],Layer[{3}]", file.GetUUIDs()[i], base.Name, base.Tag, base.Layer);
+			}
+
+			auto& family = entity.Family();
+			family.ParentID = families[i].ParentID;
+			family.ChildID = families[i].ChildID;
+			family.NextSiblingID = families[i].NextSiblingID;
+			family.PreviousSiblingID = families[i].PreviousSiblingID;
+		}
+#pragma endregion
+
+		// Camera, Script, SpriteRenderer and AudioSource go through AddComponent, their OnComponentAdded hooks matter to them.
+		// The others have none and are inserted pool by pool.
+#pragma region CameraComponent
+		for (const auto& record : cameras)
+		{
+			auto& component = getEntity(record.EntityIndex).AddComponent<CameraComponent>();
+
+			component.Camera.SetAspectRatio(record.AspectRatio);
+			component.Camera.SetProjectionType(record.ProjectionType == static_cast<uint32_t>(SceneCamera::ProjectionType::Orthographic) ? SceneCamera::ProjectionType::Orthographic : SceneCamera::ProjectionType::Perspective);
+
+			component.Camera.SetPerspectiveVerticalFOV(record.PerspectiveVerticalFOV);
+			component.Camera.SetPerspectiveNearClip(record.PerspectiveNearClip);
+			component.Camera.SetPerspectiveFarClip(record.PerspectiveFarClip);
+
+			component.Camera.SetOrthographicSize(record.OrthographicSize);
+			component.Camera.SetOrthographicNearClip(record.OrthographicNearClip);
+			component.Camera.SetOrthographicFarClip(record.OrthographicFarClip);
+
+			component.IsPrimary = record.IsPrimary;
+			component.IsFixedAspectRatio = record.IsFixedAspectRatio;
+		}
+#pragma endregion
+
+#pragma region ScriptComponent
+		for (const auto& record : scripts)
+		{
+			Entity entity = getEntity(record.EntityIndex);
+			auto& component = entity.AddComponent<ScriptComponent>();
+			component.ClassName = file.GetString(record.ClassName);
+
+			const auto entityClass = ScriptEngine::GetEntityClass(component.ClassName);
+			if (record.FieldCount == 0 || !entityClass)
+			{
+				continue;
+			}
+
+			auto& entityFields = ScriptEngine::GetScriptFieldMap(entity);
+			const auto& fields = entityClass->GetFields();
+			for (const auto& fieldRecord : scriptFields.subspan(record.FirstField, record.FieldCount))
+			{
+				const auto fieldName = file.GetString(fieldRecord.Name);
+				const auto fieldIt = fields.find(fieldName);
+				if (fieldIt == fields.end())
+				{
+					HZ_CORE_LWARN("Deserialization: Field [{0}] doesn't not exist on class [{1}]", fieldName, component.ClassName);
+					continue;
+				}
+
+				// The stored bytes only make sense for the type they were saved with.
+				const auto fieldType = static_cast<ScriptFieldType>(fieldRecord.FieldType);
+				if (fieldIt->second.Type != fieldType)
+				{
+					HZ_CORE_LWARN("Deserialization: Field [{0}] of class [{1}] changed type, its saved value is ignored", fieldName, component.ClassName);
+					continue;
+				}
+
+				auto& scriptFieldInstance = entityFields[fieldName];
+				scriptFieldInstance.Field = fieldIt->second;
+
+				if (fieldType == ScriptFieldType::String)
+				{
+					scriptFieldInstance.SetStringValue(file.GetString(fieldRecord.String));
+				}
+				else
+				{
+					Binary::ScriptFieldData fieldData;
+					memcpy(fieldData.Bytes, fieldRecord.Data, sizeof(fieldData.Bytes));
+					scriptFieldInstance.SetValue(fieldData);
+				}
+			}
+		}
+#pragma endregion
+
+#pragma region SpriteRendererComponent
+		for (const auto& record : spriteRenderers)
+		{
+			auto& component = getEntity(record.EntityIndex).AddComponent<SpriteRendererComponent>();
+
+			if (record.TexturePath.Length > 0)
+			{
+				const std::filesystem::path filePath = file.GetString(record.TexturePath);
+				component.TextureHandle = AssetManager::ImportTexture(Project::GetAssetFileSystemPath(filePath));
+				AssetManager::SetTextureMagFilter(component.TextureHandle, record.MagFilter);
+			}
+
+			component.Tiling = record.Tiling;
+			component.Color = record.Color;
+		}
+#pragma endregion
+
+#pragma region CircleRendererComponent
+		insertComponents(circleRenderers, [](const Binary::CircleRendererRecord& record)
+		{
+			CircleRendererComponent component;
+			component.Color = record.Color;
+			component.Thickness = record.Thickness;
+			component.Fade = record.Fade;
+			return component;
+		});
+#pragma endregion
+
+#pragma region TextComponent
+		insertComponents(texts, [&file](const Binary::TextRecord& record)
+		{
+			TextComponent component;
+			component.Text = file.GetString(record.Text);
+			component.Color = record.Color;
+			component.Kerning = record.Kerning;
+			component.LineSpace = record.LineSpace;
+			return component;
+		});
+#pragma endregion
+
+#pragma region Rigidbody2DComponent
+		insertComponents(rigidbodies, [](const Binary::Rigidbody2DRecord& record)
+		{
+			Rigidbody2DComponent component;
+			component.Type = record.BodyType <= static_cast<uint32_t>(Rigidbody2DComponent::BodyType::Kinematic) ? static_cast<Rigidbody2DComponent::BodyType>(record.BodyType) : Rigidbody2DComponent::BodyType::Static;
+			component.IsFixedRotation = record.IsFixedRotation;
+			return component;
+		});
+#pragma endregion
+
+#pragma region BoxCollider2DComponent
+		insertComponents(boxColliders, [](const Binary::BoxCollider2DRecord& record)
+		{
+			BoxCollider2DComponent component;
+			component.Offset = record.Offset;
+			component.Size = record.Size;
+			component.Rotation = record.Rotation;
+			component.Density = record.Density;
+			component.Friction = record.Friction;
+			component.Restitution = record.Restitution;
+			component.RestitutionThreshold = record.RestitutionThreshold;
+			return component;
+		});
+#pragma endregion
+
+#pragma region CircleCollider2DComponent
+		insertComponents(circleColliders, [](const Binary::CircleCollider2DRecord& record)
+		{
+			CircleCollider2DComponent component;
+			component.Offset = record.Offset;
+			component.Radius = record.Radius;
+			component.Density = record.Density;
+			component.Friction = record.Friction;
+			component.Restitution = record.Restitution;
+			component.RestitutionThreshold = record.RestitutionThreshold;
+			return component;
+		});
+#pragma endregion
+
+#pragma region AudioSourceComponent
+		for (const auto& record : audioSources)
+		{
+			Entity entity = getEntity(record.EntityIndex);
+			auto& component = entity.AddComponent<AudioSourceComponent>();
+			component.IsAutoPlay = record.IsAutoPlay;
+			component.IsVisibleInGame = record.IsVisibleInGame;
+
+			if (record.ClipPath.Length > 0)
+			{
+				const std::filesystem::path filePath = file.GetString(record.ClipPath);
+				component.AudioSource = AudioSource::Create(Project::GetAssetFileSystemPath(filePath)); // TODO not use path use asset.
+				if (component.AudioSource != nullptr)
+				{
+					component.AudioSource->SetGain(record.Gain);
+					component.AudioSource->SetPitch(record.Pitch);
+					component.AudioSource->SetLoop(record.IsLoop);
+					component.AudioSource->Set3D(record.Is3D);
+					component.AudioSource->SetPosition(entity.Transform().Position);
+				}
+			}
+		}
+#pragma endregion
+
+#pragma region AudioListenerComponent
+		insertComponents(audioListeners, [](const Binary::AudioListenerRecord& record)
+		{
+			AudioListenerComponent component;
+			component.IsVisibleInGame = record.IsVisibleInGame;
+			return component;
+		});
+
+		// What OnComponentAdded does for the first listener added.
+		if (!audioListeners.empty())
+		{
+			AudioEngine::SetListenerPosition(getEntity(audioListeners.front().EntityIndex).Transform().Position);
+		}
+#pragma endregion
+
+		if (const auto rootEntityChildID = file.GetHeader().RootEntityChildID)
+		{
+			_scene->GetRootEntity().Family().ChildID = rootEntityChildID;
+		}
+
+		_scene->LinkFamilies();
+
+		return true;
+	}
+
+	bool SceneBinarySerializer::ConvertYamlToBinary(const std::filesystem::path& yamlFilepath, const std::filesystem::path& binaryFilepath)
+	{
+		const auto scene = CreateRef<Scene>();
+		if (!SceneSerializer(scene).Deserialize(yamlFilepath, false))
+		{
+			return false;
+		}
+
+		SceneBinarySerializer(scene).Serialize(binaryFilepath);
+		return true;
+	}
+
+	bool SceneBinarySerializer::ConvertBinaryToYaml(const std::filesystem::path& binaryFilepath, const std::filesystem::path& yamlFilepath)
+	{
+		const auto scene = CreateRef<Scene>();
+		if (!SceneBinarySerializer(scene).Deserialize(binaryFilepath, false))
+		{
+			return false;
+		}
+
+		SceneSerializer(scene).Serialize(yamlFilepath);
+		return true;
+	}
+
+	SceneBinarySerializer::Benchmark SceneBinarySerializer::RunBenchmark(uint32_t entityCount, uint32_t iterations)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		Benchmark result;
+		result.EntityCount = entityCount;
+
+		auto scene = CreateRef<Scene>("Binary Benchmark");
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = scene->CreateEntity(fmt::format("Entity {0}", i));
+			entity.Transform().Position = {static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f};
+			entity.AddComponent<SpriteRendererComponent>();
+			if (i % 10 == 0)
+			{
+				entity.AddComponent<BoxCollider2DComponent>();
+			}
+		}
+
+		const auto directory = std::filesystem::temp_directory_path();
+		const auto yamlFilepath = directory / "BinaryBenchmark.hazel";
+		const auto binaryFilepath = directory / "BinaryBenchmark.hazelb";
+
+		result.YamlSaveMillis = Timer::MeasureFastestMillis(iterations, [&]() { SceneSerializer(scene).Serialize(yamlFilepath); });
+		result.BinarySaveMillis = Timer::MeasureFastestMillis(iterations, [&]() { SceneBinarySerializer(scene).Serialize(binaryFilepath); });
+		result.YamlLoadMillis = Timer::MeasureFastestMillis(iterations, []() { return CreateRef<Scene>(); }, [&](const Ref<Scene>& target)
+		{
+			SceneSerializer(target).Deserialize(yamlFilepath, false);
+		});
+		result.BinaryLoadMillis = Timer::MeasureFastestMillis(iterations, []() { return CreateRef<Scene>(); }, [&](const Ref<Scene>& target)
+		{
+			SceneBinarySerializer(target).Deserialize(binaryFilepath, false);
+		});
+
+		result.YamlFileSize = std::filesystem::file_size(yamlFilepath);
+		result.BinaryFileSize = std::filesystem::file_size(binaryFilepath);
+		std::filesystem::remove(yamlFilepath);
+		std::filesystem::remove(binaryFilepath);
+
+		HZ_CORE_LINFO("Scene files of {0} entities: YAML save {1}ms load {2}ms ({3} bytes), Binary save {4}ms load {5}ms ({6} bytes)",
+			entityCount, result.YamlSaveMillis, result.YamlLoadMillis, result.YamlFileSize, result.BinarySaveMillis, result.BinaryLoadMillis, result.BinaryFileSize);
+
+		return result;
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "Hazel/Utils/Serializer.h"
+#include "Scene.h"
+
+namespace Hazel
+{
+	// Versioned binary scene format, the file is memory-mapped and its component blocks are read in place.
+	class SceneBinarySerializer : public Serializer
+	{
+	public:
+		SceneBinarySerializer(const Ref<Scene>& scene);
+
+		void Serialize(const std::filesystem::path& filepath) override;
+		void SerializeRuntime() override;
+		bool Deserialize(const std::filesystem::path& filepath, bool isWithLog = true) override;
+		bool DeserializeRuntime() override;
+
+		static bool ConvertYamlToBinary(const std::filesystem::path& yamlFilepath, const std::filesystem::path& binaryFilepath);
+		static bool ConvertBinaryToYaml(const std::filesystem::path& binaryFilepath, const std::filesystem::path& yamlFilepath);
+
+		// Time spent saving and loading a scene of entityCount root level entities through files, in milliseconds.
+		struct Benchmark
+		{
+			uint32_t EntityCount = 0;
+			float YamlSaveMillis = 0.0f;
+			float YamlLoadMillis = 0.0f;
+			float BinarySaveMillis = 0.0f;
+			float BinaryLoadMillis = 0.0f;
+			uint64_t YamlFileSize = 0;
+			uint64_t BinaryFileSize = 0;
+		};
+
+		static Benchmark RunBenchmark(uint32_t entityCount = 10000, uint32_t iterations = 3);
+
+	private:
+		std::vector<uint8_t> SerializeData() const;
+		bool DeserializeData(const uint8_t* data, uint64_t size, bool isWithLog = true) const;
+
+	private:
+		Ref<Scene> _scene;
+	};
+}
@@ -4,14 +4,22 @@
 #include "Entity.h"
 #include "Components.h"
 
+#include "Hazel/Core/Application.h"
+#include "Hazel/Core/Timer.h"
 #include "Hazel/Project/Project.h"
 #include "Hazel/Scripting/ScriptEngine.h"
 #include "Hazel/Scripting/ScriptClass.h"
 
+#include <deque>
+#include <thread>
+
 namespace Hazel
 {
 	static std::string _runtimeSceneData;
 
+	// Entities emitted at once, the whole document is never held in memory.
+	static constexpr size_t kSerializeChunkSize = 1024;
+
 	SceneSerializer::SceneSerializer(const Ref<Scene>& scene)
 		: _scene(scene) {}
 
@@ -66,7 +74,28 @@ namespace Hazel
 		return Rigidbody2DComponent::BodyType::Static;
 	}
 
-	static void SerializeEntity(YAML::Emitter& out, const Entity entity)
+	static std::string MobilityToString(const TransformMobility mobility)
+	{
+		switch (mobility)
+		{
+		case TransformMobility::Dynamic: return "Dynamic";
+		case TransformMobility::Static: return "Static";
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown Mobility");
+		return {};
+	}
+
+	static TransformMobility MobilityFromString(const std::string& mobilityString)
+	{
+		if (mobilityString == "Dynamic") return TransformMobility::Dynamic;
+		if (mobilityString == "Static") return TransformMobility::Static;
+
+		HZ_CORE_ASSERT(false, "Unknown Mobility");
+		return TransformMobility::Dynamic;
+	}
+
+	void SceneSerializer::SerializeEntity(YAML::Emitter& out, const Entity entity, const EntitySnapshot& snapshot)
 	{
 		HZ_CORE_ASSERT(entity.HasComponent<IDComponent>(), "IDComponent missing!");
 
@@ -106,6 +135,7 @@ namespace Hazel
 			out << YAML::Key << "Position" << YAML::Value << component.Position;
 			out << YAML::Key << "Rotation" << YAML::Value << component.Rotation;
 			out << YAML::Key << "Scale" << YAML::Value << component.Scale;
+			out << YAML::Key << "Mobility" << YAML::Value << MobilityToString(component.Mobility);
 			out << YAML::EndMap; // TransformComponent
 		}
 #pragma endregion
@@ -151,15 +181,16 @@ namespace Hazel
 			out << YAML::Key << "ClassName" << YAML::Value << component.ClassName;
 
 			// Fields
-			if (auto entityClass = ScriptEngine::GetEntityClass(component.ClassName))
+			const auto script = snapshot.Scripts.find(entity.GetUUID());
+			if (script != snapshot.Scripts.end() && script->second.EntityClass)
 			{
-				const auto& fields = entityClass->GetFields();
+				const auto& fields = script->second.EntityClass->GetFields();
 
 				if (fields.size() > 0)
 				{
 					out << YAML::Key << "ScriptFields" << YAML::Value;
 
-					auto& entityFields = ScriptEngine::GetScriptFieldMap(entity);
+					const auto& entityFields = script->second.Fields;
 
 					out << YAML::BeginSeq; // ScriptFields Sequence
 
@@ -297,11 +328,12 @@ namespace Hazel
 			out << YAML::Key << "SpriteRendererComponent";
 			out << YAML::BeginMap; // SpriteRendererComponent
 
-			if (component.Texture != nullptr)
+			if (component.TextureHandle != UUID::Invalid)
 			{
-				const auto path = std::filesystem::relative(component.Texture->GetPath(), Project::GetAssetDirectory());
-				out << YAML::Key << "TexturePath" << YAML::Value << path; // TODO not use path but actual texture asset.
-				out << YAML::Key << "MagFilter" << YAML::Value << component.Texture->GetMagFilter();
+				// Handles only live as long as the session, files keep the path the handle is imported from.
+				const auto path = std::filesystem::relative(AssetManager::GetAssetPath(component.TextureHandle), Project::GetAssetDirectory());
+				out << YAML::Key << "TexturePath" << YAML::Value << path;
+				out << YAML::Key << "MagFilter" << YAML::Value << AssetManager::GetTextureMagFilter(component.TextureHandle);
 			}
 
 			out << YAML::Key << "Tiling" << YAML::Value << component.Tiling;
@@ -412,13 +444,14 @@ namespace Hazel
 
 			out << YAML::Key << "IsVisibleInGame" << YAML::Value << component.IsVisibleInGame;
 
-			if (component.AudioSource != nullptr)
+			const auto audioSource = snapshot.AudioSources.find(entity.GetUUID());
+			if (audioSource != snapshot.AudioSources.end())
 			{
-				out << YAML::Key << "AudioClipPath" << YAML::Value << component.AudioSource->GetPath(); // TODO not use path but actual texture asset.
-				out << YAML::Key << "Gain" << YAML::Value << component.AudioSource->GetGain();
-				out << YAML::Key << "Pitch" << YAML::Value << component.AudioSource->GetPitch();
-				out << YAML::Key << "IsLoop" << YAML::Value << component.AudioSource->GetLoop();
-				out << YAML::Key << "Is3D" << YAML::Value << component.AudioSource->Get3D();
+				out << YAML::Key << "AudioClipPath" << YAML::Value << audioSource->second.Path; // TODO not use path but actual texture asset.
+				out << YAML::Key << "Gain" << YAML::Value << audioSource->second.Gain;
+				out << YAML::Key << "Pitch" << YAML::Value << audioSource->second.Pitch;
+				out << YAML::Key << "IsLoop" << YAML::Value << audioSource->second.IsLoop;
+				out << YAML::Key << "Is3D" << YAML::Value << audioSource->second.Is3D;
 			}
 
 			out << YAML::EndMap; // AudioSourceComponent
@@ -457,44 +490,145 @@ namespace Hazel
 	{
 		_scene->SetName(filepath.filename().replace_extension().string());
 
-		YAML::Emitter out;
-		SerializeData(out);
-
 		std::ofstream fout(filepath);
-		fout << out.c_str();
+		SerializeData(fout, CaptureEntities());
 	}
 
 	void SceneSerializer::SerializeRuntime()
 	{
-		YAML::Emitter out;
-		SerializeData(out);
+		std::ostringstream stream;
+		SerializeData(stream, CaptureEntities());
+
+		_runtimeSceneData = stream.str();
+	}
+
+	std::future<bool> SceneSerializer::SerializeAsync(const Ref<Scene>& scene, const std::filesystem::path& filepath)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		scene->SetName(filepath.filename().replace_extension().string());
+
+		auto snapshotScene = Scene::Copy(scene);
+		auto snapshot = SceneSerializer(snapshotScene).CaptureEntities();
+		return std::async(std::launch::async, [snapshotScene = std::move(snapshotScene), snapshot = std::move(snapshot), filepath]() mutable
+		{
+			bool isWritten = false;
+			{
+				std::ofstream fout(filepath);
+				SceneSerializer(snapshotScene).SerializeData(fout, snapshot, true);
+				fout.close();
+				isWritten = !fout.fail();
+			}
 
-		_runtimeSceneData = out.c_str();
+			// The copy may hold the last reference to textures and audio sources, those are released on the main thread.
+			Application::Get().SubmitToMainThread([snapshotScene = std::move(snapshotScene)]() {});
+			return isWritten;
+		});
 	}
 
-	void SceneSerializer::SerializeData(YAML::Emitter& out) const
+	SceneSerializer::EntitySnapshot SceneSerializer::CaptureEntities() const
 	{
-		out << YAML::BeginMap;
-		out << YAML::Key << "Scene" << YAML::Value << _scene->GetName();
-		out << YAML::Key << "RootEntityChildID" << YAML::Value << _scene->GetRootEntity().Family().ChildID;
-		out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+		EntitySnapshot snapshot;
 
 		// Has to loop in reverse to make sure it's always serialized in the same order.
 		const auto entities = _scene->GetEntitiesGroupWith<IDComponent>();
+		snapshot.Entities.reserve(entities.size());
 		for (int i = static_cast<int>(entities.size()) - 1; i >= 0; i--)
 		{
 			const Entity entity{entities[i], _scene.get()};
+			snapshot.Entities.push_back(entity);
 
-			if (!entity)
+			if (entity.HasComponent<ScriptComponent>())
 			{
-				return;
+				auto& script = snapshot.Scripts[entity.GetUUID()];
+				script.EntityClass = ScriptEngine::GetEntityClass(entity.GetComponent<ScriptComponent>().ClassName);
+				script.Fields = ScriptEngine::GetScriptFieldMap(entity);
 			}
 
-			SerializeEntity(out, entity);
+			if (entity.HasComponent<AudioSourceComponent>())
+			{
+				if (const auto& audioSource = entity.GetComponent<AudioSourceComponent>().AudioSource)
+				{
+					snapshot.AudioSources[entity.GetUUID()] =
+					{
+						audioSource->GetPath().string(), audioSource->GetGain(), audioSource->GetPitch(), audioSource->GetLoop(), audioSource->Get3D()
+					};
+				}
+			}
 		}
 
-		out << YAML::EndSeq;
-		out << YAML::EndMap;
+		return snapshot;
+	}
+
+	// Chunks are emitted as top level sequences, indenting every line nests them under "Entities".
+	static void WriteIndentedChunk(std::ostream& stream, const char* chunk, size_t size)
+	{
+		const char* end = chunk + size;
+		for (const char* lineBegin = chunk; lineBegin < end;)
+		{
+			const char* lineEnd = std::find(lineBegin, end, '\n');
+			stream << "\n  ";
+			stream.write(lineBegin, lineEnd - lineBegin);
+			lineBegin = lineEnd + 1;
+		}
+	}
+
+	void SceneSerializer::SerializeData(std::ostream& stream, const EntitySnapshot& snapshot, bool isParallel) const
+	{
+		HZ_PROFILE_FUNCTION();
+
+		{
+			YAML::Emitter out(stream);
+			out << YAML::BeginMap;
+			out << YAML::Key << "Scene" << YAML::Value << _scene->GetName();
+			out << YAML::Key << "RootEntityChildID" << YAML::Value << _scene->GetRootEntity().Family().ChildID;
+			out << YAML::EndMap;
+		}
+
+		stream << "\nEntities:";
+		if (snapshot.Entities.empty())
+		{
+			stream << " []\n";
+			return;
+		}
+
+		auto emitChunk = [this, &snapshot](size_t begin)
+		{
+			const size_t end = std::min(begin + kSerializeChunkSize, snapshot.Entities.size());
+
+			YAML::Emitter out;
+			out << YAML::BeginSeq;
+			for (size_t i = begin; i < end; i++)
+			{
+				SerializeEntity(out, {snapshot.Entities[i], _scene.get()}, snapshot);
+			}
+			out << YAML::EndSeq;
+
+			return std::string(out.c_str(), out.size());
+		};
+
+		// At most maxPendingChunks are held in memory, they are written in order as they complete.
+		const size_t chunkCount = (snapshot.Entities.size() + kSerializeChunkSize - 1) / kSerializeChunkSize;
+		const size_t maxPendingChunks = isParallel ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+		std::deque<std::future<std::string>> pendingChunks;
+		size_t nextChunk = 0;
+		for (size_t chunk = 0; chunk < chunkCount; chunk++)
+		{
+			while (isParallel && nextChunk < chunkCount && pendingChunks.size() < maxPendingChunks)
+			{
+				pendingChunks.push_back(std::async(std::launch::async, emitChunk, nextChunk++ * kSerializeChunkSize));
+			}
+
+			const std::string text = isParallel ? pendingChunks.front().get() : emitChunk(chunk * kSerializeChunkSize);
+			if (isParallel)
+			{
+				pendingChunks.pop_front();
+			}
+
+			WriteIndentedChunk(stream, text.data(), text.size());
+		}
+
+		stream << '\n';
 	}
 
 	bool SceneSerializer::Deserialize(const std::filesystem::path& filepath, const bool isWithLog)
@@ -536,6 +670,7 @@ namespace Hazel
 
 		if (const auto entities = data["Entities"])
 		{
+			_scene->ReserveEntities(static_cast<uint32_t>(entities.size()));
 			for (const auto& entity : entities)
 			{
 				const auto entityID = entity["Entity"].as<uint64_t>();
@@ -557,9 +692,8 @@ namespace Hazel
 					HZ_CORE_LTRACE(" Entity: ID[{0}], Name[{1}],Tag[{2}],Layer[{3}]", entityID, name, tag, layer);
 				}
 
-				// TODO Improve creation of entity when deserializing so reparenting can be skip,
-				//  since it will be overriden when deserializing the FamilyComponent. 
-				auto deserializedEntity = _scene->CreateEntityWithUUID(entityID, name, tag, layer);
+				// Linked once every FamilyComponent is deserialized.
+				auto deserializedEntity = _scene->CreateUnlinkedEntityWithUUID(entityID, name, tag, layer);
 
 #pragma region TransformComponent
 				if (auto transformComponent = entity["TransformComponent"])
@@ -569,6 +703,7 @@ namespace Hazel
 					component.Position = transformComponent["Position"].as<glm::vec3>();
 					component.Rotation = transformComponent["Rotation"].as<glm::vec3>();
 					component.Scale = transformComponent["Scale"].as<glm::vec3>();
+					component.Mobility = MobilityFromString(GetValue<std::string>(transformComponent, "Mobility", "Dynamic"));
 				}
 #pragma endregion
 
@@ -753,11 +888,8 @@ namespace Hazel
 					if (auto texturePath = spriteRendererComponent["TexturePath"])
 					{
 						const auto filePath = texturePath.as<std::filesystem::path>();
-						component.Texture = Texture2D::Create(Project::GetAssetFileSystemPath(filePath)); // TODO not use path use asset.
-						if (component.Texture != nullptr)
-						{
-							component.Texture->SetMagFilter(GetValue<uint32_t>(spriteRendererComponent, "MagFilter", 0x2601));
-						}
+						component.TextureHandle = AssetManager::ImportTexture(Project::GetAssetFileSystemPath(filePath));
+						AssetManager::SetTextureMagFilter(component.TextureHandle, GetValue<uint32_t>(spriteRendererComponent, "MagFilter", 0x2601));
 					}
 
 					component.Tiling = GetValue<glm::vec2>(spriteRendererComponent, "Tiling", {1.0f, 1.0f});
@@ -889,6 +1021,50 @@ namespace Hazel
 			}
 		}
 
+		_scene->LinkFamilies();
+
 		return true;
 	}
+
+	SceneSerializer::LoadBenchmark SceneSerializer::RunLoadBenchmark(uint32_t entityCount, uint32_t iterations)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		LoadBenchmark result;
+		result.EntityCount = entityCount;
+
+		auto scene = CreateRef<Scene>("Load Benchmark");
+		result.CreateMillis = Timer::MeasureFastestMillis(iterations, []() { return CreateRef<Scene>("Load Benchmark"); }, [entityCount](const Ref<Scene>& target)
+		{
+			for (uint32_t i = 0; i < entityCount; i++)
+			{
+				target->CreateEntity("Entity");
+			}
+		});
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = scene->CreateEntity(fmt::format("Entity {0}", i));
+			entity.Transform().Position = {static_cast<float>(i % 100), static_cast<float>(i / 100), 0.0f};
+			entity.AddComponent<SpriteRendererComponent>();
+		}
+
+		std::ostringstream stream;
+		SceneSerializer serializer(scene);
+		serializer.SerializeData(stream, serializer.CaptureEntities());
+		const std::string sceneData = stream.str();
+
+		YAML::Node data;
+		result.ParseMillis = Timer::MeasureFastestMillis(iterations, [&]() { data = YAML::Load(sceneData); });
+		result.DeserializeMillis = Timer::MeasureFastestMillis(iterations, []() { return CreateRef<Scene>(); }, [&data](const Ref<Scene>& target)
+		{
+			SceneSerializer(target).DeserializeData(data, false);
+		});
+		result.CopyMillis = Timer::MeasureFastestMillis(iterations, []() { return Ref<Scene>(); }, [&scene](Ref<Scene>& copy) { copy = Scene::Copy(scene); });
+
+		HZ_CORE_LINFO("Scene load of {0} entities: Create {1}ms, Parse {2}ms, Deserialize {3}ms, Copy {4}ms",
+			entityCount, result.CreateMillis, result.ParseMillis, result.DeserializeMillis, result.CopyMillis);
+
+		return result;
+	}
 }
@@ -2,8 +2,12 @@
 #include "Hazel/Utils/Serializer.h"
 #include "Scene.h"
 
+#include <future>
+
 namespace Hazel
 {
+	class ScriptClass;
+
 	class SceneSerializer : public Serializer
 	{
 	public:
@@ -14,15 +18,59 @@ namespace Hazel
 		bool Deserialize(const std::filesystem::path& filepath, bool isWithLog = true) override;
 		bool DeserializeRuntime() override;
 
+		// Serializes a copy of the scene on worker threads, the scene can keep changing while the file is written.
+		// The future is false when the file could not be written.
+		static std::future<bool> SerializeAsync(const Ref<Scene>& scene, const std::filesystem::path& filepath);
+
+		// Time spent on a scene of entityCount root level entities, in milliseconds.
+		struct LoadBenchmark
+		{
+			uint32_t EntityCount = 0;
+			float CreateMillis = 0.0f; // CreateEntity for every entity.
+			float ParseMillis = 0.0f; // YAML text to nodes.
+			float DeserializeMillis = 0.0f; // Nodes to entities.
+			float CopyMillis = 0.0f; // Scene::Copy
+		};
+
+		static LoadBenchmark RunLoadBenchmark(uint32_t entityCount = 10000, uint32_t iterations = 3);
+
 	private:
-		void SerializeData(YAML::Emitter& out) const;
+		struct ScriptSnapshot
+		{
+			Ref<ScriptClass> EntityClass;
+			ScriptFieldMap Fields;
+		};
+
+		// Audio sources are shared with the scene copy and still changed by the main thread.
+		struct AudioSourceSnapshot
+		{
+			std::string Path;
+			float Gain = 1.0f;
+			float Pitch = 1.0f;
+			bool IsLoop = false;
+			bool Is3D = false;
+		};
+
+		// What gets emitted, gathered on the calling thread so emitting never touches the ScriptEngine or an audio source.
+		struct EntitySnapshot
+		{
+			std::vector<entt::entity> Entities;
+			std::unordered_map<UUID, ScriptSnapshot> Scripts;
+			std::unordered_map<UUID, AudioSourceSnapshot> AudioSources;
+		};
+
+		EntitySnapshot CaptureEntities() const;
+		// Entities are emitted in chunks written to the stream as soon as they are done,
+		// parallel chunks are only safe on a scene no other thread uses.
+		void SerializeData(std::ostream& stream, const EntitySnapshot& snapshot, bool isParallel = false) const;
 		bool DeserializeData(const YAML::Node& data, bool isWithLog = true) const;
 
+		static void SerializeEntity(YAML::Emitter& out, Entity entity, const EntitySnapshot& snapshot);
+
 	private:
 		Ref<Scene> _scene;
 	};
 
-	static void SerializeEntity(YAML::Emitter& out, Entity entity);
 	template<typename T>
 	static T GetValue(const YAML::Node& node, const std::string& fieldName, T fallbackValue = T());
 }
@@ -0,0 +1,366 @@
+#include "hzpch.h"
+#include "TransformHierarchy.h"
+
+#include "Hazel/Core/Timer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Hazel
+{
+	// Smaller levels are swept on the calling thread, splitting them costs more than it saves.
+	static constexpr uint32_t kMinParallelLevelSize = 8192;
+
+	// Threads started once and kept for every update, a level is split between them and the calling thread.
+	class TransformWorkers
+	{
+	public:
+		static TransformWorkers& Get()
+		{
+			static TransformWorkers workers;
+			return workers;
+		}
+
+		TransformWorkers()
+		{
+			const uint32_t workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+			for (uint32_t i = 0; i < workerCount; i++)
+			{
+				_workers.emplace_back(&TransformWorkers::Work, this);
+			}
+		}
+
+		~TransformWorkers()
+		{
+			{
+				std::scoped_lock lock(_mutex);
+				_isShuttingDown = true;
+			}
+			_startCondition.notify_all();
+
+			for (auto& worker : _workers)
+			{
+				worker.join();
+			}
+		}
+
+		// Workers plus the calling thread.
+		uint32_t GetThreadCount() const { return static_cast<uint32_t>(_workers.size()) + 1; }
+
+		// Calls function for every chunk in [0, chunkCount) and returns once they are all done.
+		void Run(uint32_t chunkCount, const std::function<void(uint32_t)>& function)
+		{
+			// Scenes updated from several threads take turns.
+			std::scoped_lock runLock(_runMutex);
+			{
+				std::scoped_lock lock(_mutex);
+				_function = &function;
+				_chunkCount = chunkCount;
+				_nextChunk = 0;
+				_busyWorkerCount = static_cast<uint32_t>(_workers.size());
+				_generation++;
+			}
+			_startCondition.notify_all();
+
+			RunChunks();
+
+			std::unique_lock lock(_mutex);
+			_doneCondition.wait(lock, [this] { return _busyWorkerCount == 0; });
+			_function = nullptr;
+		}
+
+	private:
+		void RunChunks()
+		{
+			for (uint32_t chunk = _nextChunk++; chunk < _chunkCount; chunk = _nextChunk++)
+			{
+				(*_function)(chunk);
+			}
+		}
+
+		void Work()
+		{
+			uint64_t doneGeneration = 0;
+			while (true)
+			{
+				{
+					std::unique_lock lock(_mutex);
+					_startCondition.wait(lock, [&] { return _isShuttingDown || _generation != doneGeneration; });
+					if (_isShuttingDown)
+					{
+						return;
+					}
+
+					doneGeneration = _generation;
+				}
+
+				RunChunks();
+
+				std::scoped_lock lock(_mutex);
+				if (--_busyWorkerCount == 0)
+				{
+					_doneCondition.notify_one();
+				}
+			}
+		}
+
+	private:
+		std::vector<std::thread> _workers;
+		std::mutex _runMutex;
+		std::mutex _mutex;
+		std::condition_variable _startCondition;
+		std::condition_variable _doneCondition;
+
+		const std::function<void(uint32_t)>* _function = nullptr;
+		uint32_t _chunkCount = 0;
+		std::atomic<uint32_t> _nextChunk = 0;
+		uint32_t _busyWorkerCount = 0;
+		uint64_t _generation = 0;
+		bool _isShuttingDown = false;
+	};
+
+	void TransformHierarchy::Rebuild(entt::registry& registry, const std::unordered_map<UUID, entt::entity>& entityMap)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		struct PendingEntry
+		{
+			entt::entity Entity;
+			int32_t ParentIndex;
+		};
+
+		_registry = &registry;
+		_entities.clear();
+		_parentIndices.clear();
+		_levelOffsets.assign(1, 0);
+		_dynamicOffsets.clear();
+		_staticCount = 0;
+
+		auto isInStaticSubtree = [&](const PendingEntry& entry)
+		{
+			const bool isParentStatic = entry.ParentIndex < 0 || registry.get<TransformComponent>(_entities[entry.ParentIndex]).IsInStaticSubtree();
+			return isParentStatic && registry.get<TransformComponent>(entry.Entity).Mobility == TransformMobility::Static;
+		};
+
+		std::vector<PendingEntry> currentLevel;
+		std::vector<PendingEntry> nextLevel;
+		for (const auto&& [enttID, family, transform] : registry.view<FamilyComponent, TransformComponent>().each())
+		{
+			// A parent missing from the scene would leave the whole subtree out of every update.
+			if (!family.ParentID || !entityMap.contains(family.ParentID))
+			{
+				currentLevel.push_back({enttID, -1});
+			}
+		}
+
+		while (!currentLevel.empty())
+		{
+			const auto firstDynamic = std::stable_partition(currentLevel.begin(), currentLevel.end(), isInStaticSubtree);
+			const auto levelStaticCount = static_cast<uint32_t>(firstDynamic - currentLevel.begin());
+			_dynamicOffsets.push_back(static_cast<uint32_t>(_entities.size()) + levelStaticCount);
+			_staticCount += levelStaticCount;
+
+			for (const auto& entry : currentLevel)
+			{
+				const auto index = static_cast<int32_t>(_entities.size());
+
+				auto& transform = registry.get<TransformComponent>(entry.Entity);
+				transform.ParentTransform = entry.ParentIndex >= 0 ? &registry.get<TransformComponent>(_entities[entry.ParentIndex]) : nullptr;
+				transform._isInStaticSubtree = static_cast<uint32_t>(index) < _dynamicOffsets.back();
+				_entities.push_back(entry.Entity);
+				_parentIndices.push_back(entry.ParentIndex);
+
+				auto childID = registry.get<FamilyComponent>(entry.Entity).ChildID;
+				while (childID)
+				{
+					const auto it = entityMap.find(childID);
+					if (it == entityMap.end())
+					{
+						break;
+					}
+
+					nextLevel.push_back({it->second, index});
+					childID = registry.get<FamilyComponent>(it->second).NextSiblingID;
+				}
+			}
+
+			_levelOffsets.push_back(static_cast<uint32_t>(_entities.size()));
+			std::swap(currentLevel, nextLevel);
+			nextLevel.clear();
+		}
+
+		// Version 0 is never used by a computed transform, every packed entry gets refreshed on the next update.
+		_worldTransforms.assign(_entities.size(), glm::mat4(1.0f));
+		_worldVersions.assign(_entities.size(), 0);
+	}
+
+	bool TransformHierarchy::Update(bool parallel)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!_registry)
+		{
+			return false;
+		}
+
+		const entt::registry& registry = *_registry;
+		bool hasStaticChanged = false;
+		for (uint32_t level = 0; level < GetDepth(); level++)
+		{
+			// Static entries rarely change, checking them is cheap enough to stay on this thread.
+			hasStaticChanged |= UpdateRange(registry, _levelOffsets[level], _dynamicOffsets[level]);
+
+			const uint32_t begin = _dynamicOffsets[level];
+			const uint32_t end = _levelOffsets[level + 1];
+			const uint32_t levelSize = end - begin;
+			if (!parallel || levelSize < kMinParallelLevelSize || TransformWorkers::Get().GetThreadCount() == 1)
+			{
+				UpdateRange(registry, begin, end);
+				continue;
+			}
+
+			// Entries of a level only read their parent from the previous level, any split works.
+			auto& workers = TransformWorkers::Get();
+			const uint32_t chunkCount = workers.GetThreadCount();
+			const uint32_t chunkSize = (levelSize + chunkCount - 1) / chunkCount;
+			workers.Run(chunkCount, [&](uint32_t chunk)
+			{
+				const uint32_t chunkBegin = begin + chunk * chunkSize;
+				UpdateRange(registry, std::min(chunkBegin, end), std::min(chunkBegin + chunkSize, end));
+			});
+		}
+
+		return hasStaticChanged;
+	}
+
+	bool TransformHierarchy::UpdateRange(const entt::registry& registry, uint32_t begin, uint32_t end)
+	{
+		bool hasChanged = false;
+		for (uint32_t i = begin; i < end; i++)
+		{
+			// Destroyed since the last rebuild, the scene rebuilds before its next update.
+			const auto* transformComponent = registry.try_get<TransformComponent>(_entities[i]);
+			if (!transformComponent)
+			{
+				continue;
+			}
+
+			const TransformComponent& transform = *transformComponent;
+			if (transform.IsWorldTransformCurrent())
+			{
+				// GetWorldTransformMatrix may have refreshed the cache since the last update.
+				if (_worldVersions[i] != transform.GetWorldVersion())
+				{
+					_worldTransforms[i] = transform.GetCachedWorldTransformMatrix();
+					_worldVersions[i] = transform.GetWorldVersion();
+				}
+
+				continue;
+			}
+
+			const int32_t parentIndex = _parentIndices[i];
+			_worldTransforms[i] = parentIndex >= 0 ? _worldTransforms[parentIndex] * transform.GetLocalTransformMatrix() : transform.GetLocalTransformMatrix();
+
+			transform.StoreWorldTransform(_worldTransforms[i]);
+			_worldVersions[i] = transform.GetWorldVersion();
+			hasChanged = true;
+		}
+
+		return hasChanged;
+	}
+
+	// What GetWorldTransformMatrix did before world transforms were cached.
+	static glm::mat4 ComputeWorldTransformRecursive(const TransformComponent& transform)
+	{
+		if (transform.ParentTransform)
+		{
+			return ComputeWorldTransformRecursive(*transform.ParentTransform) * transform.GetLocalTransformMatrix();
+		}
+
+		return transform.GetLocalTransformMatrix();
+	}
+
+	TransformHierarchy::Benchmark TransformHierarchy::RunBenchmark(uint32_t entityCount, uint32_t depth, uint32_t iterations)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(depth > 0 && depth <= entityCount, "Depth must be between 1 and the entity count");
+
+		// Levels of equal size, every entry is the child of an entry of the previous level.
+		entt::registry registry;
+		std::unordered_map<UUID, entt::entity> entityMap;
+		std::vector<entt::entity> entities(entityCount);
+		const uint32_t levelSize = entityCount / depth;
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			entities[i] = registry.create();
+			registry.emplace<FamilyComponent>(entities[i]);
+
+			auto& transform = registry.emplace<TransformComponent>(entities[i]);
+			const auto value = static_cast<float>(i);
+			transform.Position = {value * 0.01f, value * -0.02f, 0.0f};
+			transform.Rotation = {0.0f, 0.0f, value * 0.001f};
+
+			entityMap[UUID(i + 1)] = entities[i];
+		}
+
+		std::vector<uint32_t> lastChildren(entityCount, UINT32_MAX);
+		for (uint32_t i = levelSize; i < entityCount; i++)
+		{
+			const uint32_t level = std::min(i / levelSize, depth - 1);
+			const uint32_t parent = (level - 1) * levelSize + i % levelSize;
+
+			auto& family = registry.get<FamilyComponent>(entities[i]);
+			family.ParentID = UUID(parent + 1);
+			if (lastChildren[parent] == UINT32_MAX)
+			{
+				registry.get<FamilyComponent>(entities[parent]).ChildID = UUID(i + 1);
+			}
+			else
+			{
+				registry.get<FamilyComponent>(entities[lastChildren[parent]]).NextSiblingID = UUID(i + 1);
+				family.PreviousSiblingID = UUID(lastChildren[parent] + 1);
+			}
+
+			lastChildren[parent] = i;
+		}
+
+		TransformHierarchy hierarchy;
+		hierarchy.Rebuild(registry, entityMap);
+
+		auto view = registry.view<TransformComponent>();
+		std::vector<glm::mat4> recursiveResults(entityCount);
+
+		uint32_t changeCount = 0;
+		auto changeTransforms = [&]()
+		{
+			const float scale = 1.0f + static_cast<float>(changeCount++ % 2) * 0.5f;
+			for (const auto&& [enttID, transform] : view.each())
+			{
+				transform.Scale.x = scale;
+			}
+		};
+
+		Benchmark result;
+		result.EntityCount = entityCount;
+		result.Depth = hierarchy.GetDepth();
+		result.RecursiveMillis = Timer::MeasureFastestMillis(iterations, [&]()
+		{
+			uint32_t i = 0;
+			for (const auto&& [enttID, transform] : view.each())
+			{
+				recursiveResults[i++] = ComputeWorldTransformRecursive(transform);
+			}
+		});
+		result.PackedMillis = Timer::MeasureFastestMillis(iterations, changeTransforms, [&]() { hierarchy.Update(false); });
+		result.PackedParallelMillis = Timer::MeasureFastestMillis(iterations, changeTransforms, [&]() { hierarchy.Update(true); });
+		result.UnchangedMillis = Timer::MeasureFastestMillis(iterations, [&]() { hierarchy.Update(true); });
+
+		HZ_CORE_LINFO("Transform hierarchy of {0} entities, depth {1}: Recursive {2}ms, Packed {3}ms, Packed parallel {4}ms, Unchanged {5}ms",
+			entityCount, result.Depth, result.RecursiveMillis, result.PackedMillis, result.PackedParallelMillis, result.UnchangedMillis);
+
+		return result;
+	}
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Hazel/Core/UUID.h"
+#include "Hazel/Scene/Components.h"
+
+#include "entt.hpp"
+
+namespace Hazel
+{
+	// Transforms stored parent before child, one depth level after the other, with their world matrices packed in one array.
+	// World transforms are then computed in a single linear sweep, each level only reading the one before it.
+	class TransformHierarchy
+	{
+	public:
+		// Time to compute every world transform, in milliseconds.
+		struct Benchmark
+		{
+			uint32_t EntityCount = 0;
+			uint32_t Depth = 0;
+			float RecursiveMillis = 0.0f; // Parent chain walked for every entity, no caching.
+			float PackedMillis = 0.0f; // Every transform changed.
+			float PackedParallelMillis = 0.0f; // Every transform changed, levels split across threads.
+			float UnchangedMillis = 0.0f; // Nothing changed since the last update.
+		};
+
+	public:
+		// Walks FamilyComponent links from the entities without parent, those whose parent is gone are treated as roots.
+		// Also repairs TransformComponent::ParentTransform, which points into entt storage and may dangle after components
+		// were added or removed.
+		void Rebuild(entt::registry& registry, const std::unordered_map<UUID, entt::entity>& entityMap);
+
+		// Recomputes the world transforms of changed entries and their descendants.
+		// True when a static subtree transform was recomputed, anything baked from those is out of date.
+		bool Update(bool parallel = true);
+
+		uint32_t GetSize() const { return static_cast<uint32_t>(_entities.size()); }
+		uint32_t GetDepth() const { return static_cast<uint32_t>(_levelOffsets.size()) - 1; }
+		uint32_t GetStaticCount() const { return _staticCount; }
+
+		static Benchmark RunBenchmark(uint32_t entityCount = 100000, uint32_t depth = 8, uint32_t iterations = 10);
+
+	private:
+		// True when a world transform was recomputed.
+		bool UpdateRange(const entt::registry& registry, uint32_t begin, uint32_t end);
+
+	private:
+		// Handles rather than component pointers, entt storage moves when components are added or removed.
+		const entt::registry* _registry = nullptr;
+		std::vector<entt::entity> _entities;
+		std::vector<int32_t> _parentIndices; // -1 for entries without parent.
+		std::vector<glm::mat4> _worldTransforms;
+		std::vector<uint64_t> _worldVersions; // Version of each transform when its packed world transform was written.
+		std::vector<uint32_t> _levelOffsets{0}; // Level i spans [_levelOffsets[i], _levelOffsets[i + 1]).
+		std::vector<uint32_t> _dynamicOffsets; // Each level lists its static subtree entries first, dynamic ones start here.
+
+		uint32_t _staticCount = 0;
+	};
+}
@@ -5,14 +5,38 @@
 #include "mono/jit/jit.h"
 #include "mono/metadata/assembly.h"
 #include "mono/metadata/object.h"
+#include "mono/metadata/class.h"
 
 namespace Hazel
 {
+	namespace Utils
+	{
+		template<typename Thunk>
+		static Thunk GetUnmanagedThunk(MonoMethod* monoMethod)
+		{
+			return monoMethod ? reinterpret_cast<Thunk>(mono_method_get_unmanaged_thunk(monoMethod)) : nullptr;
+		}
+	}
+
 	ScriptClass::ScriptClass(const std::string& classNamespace, const std::string& className, bool isCore)
 		: _classNamespace(classNamespace), _className(className)
 	{
 		_monoClass = mono_class_from_name(isCore ? ScriptEngine::GetCoreAssemblyImage() : ScriptEngine::GetAppAssemblyImage(), classNamespace.c_str(), className.c_str());
 		_classFullName = fmt::format("{}.{}", _classNamespace, _className);
+
+		if (!_monoClass)
+		{
+			return;
+		}
+
+		_onCreateMethod = GetMethod("OnCreate");
+		_onDestroyMethod = GetMethod("OnDestroy");
+		_onUpdateMethod = GetMethod("OnUpdate", 1);
+
+		// Skips mono_runtime_invoke argument boxing and reflection checks, the JIT compiles a wrapper once per method.
+		_onCreateThunk = Utils::GetUnmanagedThunk<MethodThunk>(_onCreateMethod);
+		_onDestroyThunk = Utils::GetUnmanagedThunk<MethodThunk>(_onDestroyMethod);
+		_onUpdateThunk = Utils::GetUnmanagedThunk<UpdateThunk>(_onUpdateMethod);
 	}
 
 	MonoObject* ScriptClass::Instanciate(MonoMethod* constructor, void** params)
@@ -54,9 +78,36 @@ namespace Hazel
 		return mono_class_get_method_from_name(_monoClass, name.c_str(), paramsCount);
 	}
 
+	const ScriptField* ScriptClass::GetField(const std::string& name) const
+	{
+		const auto it = _fields.find(name);
+		return it != _fields.end() ? &it->second : nullptr;
+	}
+
+	void ScriptClass::AddField(ScriptField field)
+	{
+		const auto name = field.Name;
+		field.Index = static_cast<uint32_t>(_fieldsByIndex.size());
+		field.Offset = mono_field_get_offset(field.MonoClassField);
+
+		MonoType* monoType = mono_field_get_type(field.MonoClassField);
+		if (!mono_type_is_reference(monoType))
+		{
+			int alignment;
+			const int size = mono_type_size(monoType, &alignment);
+			field.Size = size <= 16 ? static_cast<uint32_t>(size) : 0;
+		}
+		if (const auto [it, isInserted] = _fields.emplace(name, std::move(field)); isInserted)
+		{
+			_fieldsByIndex.push_back(&it->second);
+		}
+	}
+
 	MonoObject* ScriptClass::InvokeMethod(MonoObject* instance, MonoMethod* monoMethod, void** params)
 	{
 		MonoObject* exception = nullptr;
-		return mono_runtime_invoke(monoMethod, instance, params, &exception);
+		MonoObject* result = mono_runtime_invoke(monoMethod, instance, params, &exception);
+		ScriptEngine::LogException(exception);
+		return result;
 	}
 }
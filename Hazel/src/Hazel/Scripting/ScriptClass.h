@@ -8,15 +8,29 @@ extern "C" // Forward declare of class from C
 	typedef struct _MonoObject MonoObject;
 	typedef struct _MonoMethod MonoMethod;
 	typedef struct _MonoClassField MonoClassField;
+	typedef struct _MonoException MonoException;
 }
 
+// Unmanaged thunks use the platform calling convention of managed to native calls.
+#ifdef HZ_PLATFORM_WINDOWS
+#	define HZ_MONO_THUNK_CALL __stdcall
+#else
+#	define HZ_MONO_THUNK_CALL
+#endif // HZ_PLATFORM_WINDOWS
+
 namespace Hazel
 {
 	class ScriptClass
 	{
+	public:
+		// Entity callbacks called as plain functions, the instance first and the thrown exception written to the last argument.
+		using MethodThunk = void(HZ_MONO_THUNK_CALL*)(MonoObject* instance, MonoException** exception);
+		using UpdateThunk = void(HZ_MONO_THUNK_CALL*)(MonoObject* instance, float timestep, MonoException** exception);
+
 	public:
 		ScriptClass() = default;
 		ScriptClass(const std::string& classNamespace, const std::string& className, bool isCore = false);
+		ScriptClass(const ScriptClass&) = delete;
 
 		MonoObject* Instanciate(MonoMethod* constructor = nullptr, void** params = nullptr);
 		MonoMethod* GetMethod(const std::string& name, int paramsCount = 0);
@@ -24,6 +38,13 @@ namespace Hazel
 
 		const std::string& GetFullName() const { return _classFullName; }
 		const std::unordered_map<std::string, ScriptField>& GetFields() const { return _fields; }
+		// Null when the class has no such field.
+		const ScriptField* GetField(const std::string& name) const;
+		const ScriptField& GetField(uint32_t index) const { return *_fieldsByIndex[index]; }
+		uint32_t GetFieldCount() const { return static_cast<uint32_t>(_fieldsByIndex.size()); }
+
+	private:
+		void AddField(ScriptField field);
 
 	private:
 		std::string _classNamespace;
@@ -31,9 +52,18 @@ namespace Hazel
 		std::string _classFullName;
 
 		std::unordered_map<std::string, ScriptField> _fields;
+		std::vector<const ScriptField*> _fieldsByIndex; // Into _fields, its nodes never move.
 
 		MonoClass* _monoClass = nullptr;
 
+		// Resolved once per class, instances share them.
+		MonoMethod* _onCreateMethod = nullptr;
+		MonoMethod* _onDestroyMethod = nullptr;
+		MonoMethod* _onUpdateMethod = nullptr;
+		MethodThunk _onCreateThunk = nullptr;
+		MethodThunk _onDestroyThunk = nullptr;
+		UpdateThunk _onUpdateThunk = nullptr;
+
 		friend class ScriptEngine;
 		friend class ScriptInstance;
 	};
@@ -2,6 +2,7 @@
 #include "Hazel/Scene/Scene.h"
 #include "Hazel/Core/Application.h"
 #include "Hazel/Core/FileSystem.h"
+#include "Hazel/Core/Timer.h"
 #include "Hazel/Project/Project.h"
 
 #include "ScriptEngine.h"
@@ -128,6 +129,11 @@ namespace Hazel
 		}
 	}
 
+	// Static methods of Hazel.ScriptUpdateDispatcher.
+	using DispatcherInstanceThunk = void(HZ_MONO_THUNK_CALL*)(MonoObject* instance, MonoException** exception);
+	using DispatcherUpdateThunk = void(HZ_MONO_THUNK_CALL*)(float timestep, MonoException** exception);
+	using DispatcherClearThunk = void(HZ_MONO_THUNK_CALL*)(MonoException** exception);
+
 	struct ScriptEngineData
 	{
 		MonoDomain* RootDomain = nullptr;
@@ -142,10 +148,16 @@ namespace Hazel
 		Ref<ScriptClass> EntityBaseClass;
 
 		std::unordered_map<std::string, Ref<ScriptClass>> EntityClasses;
-		std::unordered_map<UUID, Ref<ScriptInstance>> EntityInstances;
 
 		std::unordered_map<UUID, ScriptFieldMap> EntityScriptFields;
 
+		// Update Dispatcher
+		DispatcherInstanceThunk RegisterUpdateThunk = nullptr;
+		DispatcherInstanceThunk UnregisterUpdateThunk = nullptr;
+		DispatcherUpdateThunk DispatchUpdateThunk = nullptr;
+		DispatcherClearThunk ClearUpdatesThunk = nullptr;
+		bool AreBatchedUpdatesEnabled = false;
+
 		// Runtime
 		Scene* SceneContext = nullptr;
 
@@ -216,16 +228,27 @@ namespace Hazel
 
 	void ScriptEngine::OnRuntimeStop()
 	{
-		for (auto& [uuid, instance] : sScriptData->EntityInstances)
+		if (auto* scene = sScriptData->SceneContext)
 		{
-			instance->InvokeOnDestroy();
+			std::vector<entt::entity> scriptEntities;
+			for (auto&& [enttID, component] : scene->GetEntitiesViewWith<ScriptInstanceComponent>().each())
+			{
+				component.Instance->InvokeOnDestroy();
+				scriptEntities.push_back(enttID);
+			}
+
+			ClearUpdates();
+
+			// Releases the instances and their GC handles.
+			for (const auto enttID : scriptEntities)
+			{
+				Entity{enttID, scene}.RemoveComponent<ScriptInstanceComponent>();
+			}
 		}
 
 		mono_domain_finalize(mono_get_root_domain(), -1);
 		sScriptData->SceneContext = nullptr;
 
-		sScriptData->EntityInstances.clear();
-
 
 		if (sScriptData->IsAssemblyReloading)
 		{
@@ -273,7 +296,7 @@ namespace Hazel
 
 		const UUID entityUUID = entity.GetUUID();
 
-		if (instance = GetEntityScriptInstance(entityUUID))
+		if (instance = GetEntityScriptInstance(entity))
 		{
 			return instance;
 		}
@@ -281,7 +304,7 @@ namespace Hazel
 		if (!entity.HasComponent<ScriptComponent>())
 		{
 			instance = CreateRef<ScriptInstance>(sScriptData->EntityBaseClass, entity);
-			sScriptData->EntityInstances[entityUUID] = instance;
+			entity.AddComponent<ScriptInstanceComponent>(instance);
 			instance->InvokeOnCreate();
 			return instance;
 		}
@@ -290,75 +313,108 @@ namespace Hazel
 		if (EntityClassExist(scriptComponent.ClassName))
 		{
 			instance = CreateRef<ScriptInstance>(sScriptData->EntityClasses[scriptComponent.ClassName], entity);
-			sScriptData->EntityInstances[entityUUID] = instance;
+			entity.AddComponent<ScriptInstanceComponent>(instance);
 
 			// Copy field values
-			if (sScriptData->EntityScriptFields.contains(entityUUID))
+			if (const auto it = sScriptData->EntityScriptFields.find(entityUUID); it != sScriptData->EntityScriptFields.end())
 			{
-				const auto& fieldMap = sScriptData->EntityScriptFields.at(entityUUID);
-
-				for (const auto& [name, fieldInstance] : fieldMap)
-				{
-					switch (fieldInstance.Field.Type)
-					{
-					case ScriptFieldType::String:
-					{
-						instance->TrySetFieldStringValueInternal(name, fieldInstance._stringData);
-						break;
-					}
-					case ScriptFieldType::Entity:
-					{
-						const auto fieldEntityUUID = fieldInstance.GetValue<uint64_t>();
-						if (auto foundEntity = sScriptData->SceneContext->GetEntityByUUID(fieldEntityUUID))
-						{
-							const auto& foundEntityInstance = OnCreateEntity(foundEntity);
-							HZ_ASSERT(foundEntityInstance, "Failed at Creating {0} Instance", foundEntity.Name());
-							instance->TrySetFieldValueInternal(name, foundEntityInstance->_instance);
-						}
-						break;
-					}
-					default:
-						instance->TrySetFieldValueInternal(name, fieldInstance._dataBuffer);
-						break;
-					}
-				}
+				InitializeFields(*instance, it->second);
 			}
 
+			// Registered first, OnCreate may already destroy the entity.
+			RegisterUpdate(instance);
 			instance->InvokeOnCreate();
 		}
 
 		return instance;
 	}
 
+	void ScriptEngine::InitializeFields(ScriptInstance& instance, const ScriptFieldMap& fieldMap)
+	{
+		const auto& scriptClass = *instance._scriptClass;
+		for (const auto& [name, fieldInstance] : fieldMap)
+		{
+			// Values saved before the field was removed or its type changed are left out.
+			const auto* field = scriptClass.GetField(name);
+			if (!field || field->Type != fieldInstance.Field.Type)
+			{
+				continue;
+			}
+
+			switch (field->Type)
+			{
+			case ScriptFieldType::String:
+			{
+				instance.SetFieldStringValueInternal(*field, fieldInstance._stringData);
+				break;
+			}
+			case ScriptFieldType::Entity:
+			{
+				const auto fieldEntityUUID = fieldInstance.GetValue<uint64_t>();
+				if (auto foundEntity = sScriptData->SceneContext->GetEntityByUUID(fieldEntityUUID))
+				{
+					const auto& foundEntityInstance = OnCreateEntity(foundEntity);
+					HZ_ASSERT(foundEntityInstance, "Failed at Creating {0} Instance", foundEntity.Name());
+					instance.SetFieldValueInternal(*field, foundEntityInstance->_instance);
+				}
+				break;
+			}
+			default:
+				instance.SetFieldValueInternal(*field, fieldInstance._dataBuffer);
+				break;
+			}
+		}
+	}
+
 	void ScriptEngine::OnDestroyEntity(Entity entity)
 	{
-		const auto entityUUID = entity.GetUUID();
-		if (sScriptData->EntityInstances.contains(entityUUID))
+		if (entity.HasComponent<ScriptInstanceComponent>())
 		{
-			const auto& instance = sScriptData->EntityInstances[entityUUID];
+			// Kept alive past the component, OnDestroy may still use it.
+			const auto instance = entity.GetComponent<ScriptInstanceComponent>().Instance;
+			UnregisterUpdate(instance);
 			instance->InvokeOnDestroy();
-			sScriptData->EntityInstances.erase(entityUUID);
+			entity.RemoveComponent<ScriptInstanceComponent>();
 		}
 		else
 		{
-			HZ_CORE_LERROR("Entity [{0}] UUID [{1}] missing ScriptInstance", entity.Name(), entityUUID);
+			HZ_CORE_LERROR("Entity [{0}] UUID [{1}] missing ScriptInstance", entity.Name(), entity.GetUUID());
 		}
 	}
 
 	void ScriptEngine::OnUpdateEntity(Entity entity, Timestep timestep)
 	{
-		const auto entityUUID = entity.GetUUID();
-		if (sScriptData->EntityInstances.contains(entityUUID))
+		if (entity.HasComponent<ScriptInstanceComponent>())
 		{
-			const auto& instance = sScriptData->EntityInstances[entityUUID];
-			instance->InvokeOnUpdate(timestep);
+			entity.GetComponent<ScriptInstanceComponent>().Instance->InvokeOnUpdate(timestep);
 		}
 		else
 		{
-			HZ_CORE_LERROR("Entity [{0}] UUID [{1}] missing ScriptInstance", entity.Name(), entityUUID);
+			HZ_CORE_LERROR("Entity [{0}] UUID [{1}] missing ScriptInstance", entity.Name(), entity.GetUUID());
 		}
 	}
 
+	void ScriptEngine::OnUpdateEntities(Timestep timestep)
+	{
+		if (sScriptData->DispatchUpdateThunk)
+		{
+			MonoException* exception = nullptr;
+			sScriptData->DispatchUpdateThunk(timestep, &exception);
+			LogException(reinterpret_cast<MonoObject*>(exception));
+		}
+	}
+
+	void ScriptEngine::SetBatchedUpdatesEnabled(bool enabled)
+	{
+		sScriptData->AreBatchedUpdatesEnabled = enabled;
+	}
+
+	bool ScriptEngine::AreBatchedUpdatesEnabled()
+	{
+		// Falls back to per entity updates when the core assembly has no dispatcher.
+		return sScriptData->AreBatchedUpdatesEnabled && sScriptData->DispatchUpdateThunk;
+	}
+
 	Scene* ScriptEngine::GetSceneContext()
 	{
 		return sScriptData->SceneContext;
@@ -393,15 +449,24 @@ namespace Hazel
 		sScriptData->EntityScriptFields.erase(entity.GetUUID());
 	}
 
+	Ref<ScriptInstance> ScriptEngine::GetEntityScriptInstance(Entity entity)
+	{
+		if (entity && entity.HasComponent<ScriptInstanceComponent>())
+		{
+			return entity.GetComponent<ScriptInstanceComponent>().Instance;
+		}
+
+		return nullptr;
+	}
+
 	Ref<ScriptInstance> ScriptEngine::GetEntityScriptInstance(UUID entityID)
 	{
-		auto it = sScriptData->EntityInstances.find(entityID);
-		if (it == sScriptData->EntityInstances.end())
+		if (auto* scene = sScriptData->SceneContext)
 		{
-			return nullptr;
+			return GetEntityScriptInstance(scene->GetEntityByUUID(entityID));
 		}
 
-		return it->second;
+		return nullptr;
 	}
 
 	void ScriptEngine::InitMono()
@@ -466,6 +531,11 @@ namespace Hazel
 
 		sScriptData->EntityBaseClass.reset();
 		sScriptData->EntityClasses.clear();
+
+		sScriptData->RegisterUpdateThunk = nullptr;
+		sScriptData->UnregisterUpdateThunk = nullptr;
+		sScriptData->DispatchUpdateThunk = nullptr;
+		sScriptData->ClearUpdatesThunk = nullptr;
 	}
 
 	bool ScriptEngine::TrySetupEngine()
@@ -491,13 +561,36 @@ namespace Hazel
 		{
 			const auto baseClass = CreateRef<ScriptClass>("Hazel", "Entity", true);
 
-			const std::string fieldName = "Id";
-			const auto field = mono_class_get_field_from_name(baseClass->_monoClass, fieldName.c_str());
-			baseClass->_fields.emplace(fieldName, ScriptField{ScriptFieldType::ULong, fieldName, field});
+			for (const auto& [fieldName, fieldType] : {std::pair{"Id", ScriptFieldType::ULong}, std::pair{"Handle", ScriptFieldType::UInt}})
+			{
+				const auto field = mono_class_get_field_from_name(baseClass->_monoClass, fieldName);
+				baseClass->AddField(ScriptField{fieldType, fieldName, field});
+			}
 
 			sScriptData->EntityBaseClass = baseClass;
 		}
 
+		{
+			ScriptClass dispatcherClass("Hazel", "ScriptUpdateDispatcher", true);
+			if (dispatcherClass._monoClass)
+			{
+				auto getThunk = [&dispatcherClass](const std::string& name, int paramsCount)
+				{
+					MonoMethod* monoMethod = dispatcherClass.GetMethod(name, paramsCount);
+					return monoMethod ? mono_method_get_unmanaged_thunk(monoMethod) : nullptr;
+				};
+
+				sScriptData->RegisterUpdateThunk = reinterpret_cast<DispatcherInstanceThunk>(getThunk("Register", 1));
+				sScriptData->UnregisterUpdateThunk = reinterpret_cast<DispatcherInstanceThunk>(getThunk("Unregister", 1));
+				sScriptData->DispatchUpdateThunk = reinterpret_cast<DispatcherUpdateThunk>(getThunk("Update", 1));
+				sScriptData->ClearUpdatesThunk = reinterpret_cast<DispatcherClearThunk>(getThunk("Clear", 0));
+			}
+			else
+			{
+				HZ_CORE_LWARN("Hazel.ScriptUpdateDispatcher missing from the core assembly, batched updates disabled.");
+			}
+		}
+
 		return true;
 	}
 
@@ -584,123 +677,135 @@ namespace Hazel
 
 			sScriptData->EntityClasses[fullName] = scriptClass;
 
-			int fieldCounts = mono_class_num_fields(monoClass);
-			HZ_CORE_LINFO("Class {0}", className);
-			HZ_CORE_LDEBUG("  {1} fields: ", className, fieldCounts);
-			void* iterator = nullptr;
+			LoadClassFields(*scriptClass, entityClass, loadingDomain);
 
-			while (MonoClassField* field = mono_class_get_fields(monoClass, &iterator))
-			{
-				const auto type = mono_type_get_underlying_type(mono_field_get_type(field));
-				auto scriptFieldType = Utils::MonoTypeToScriptFieldType(type);
+			// TODO Revisit property
+			//int propertyCounts = mono_class_num_properties(monoClass);
+			//HZ_CORE_LDEBUG("  {0} properties: ", propertyCounts);
+			//iterator = nullptr;
+			//while (MonoProperty* prop = mono_class_get_properties(monoClass, &iterator))
+			//{
+			//	HZ_CORE_LTRACE("    {0}", mono_property_get_name(prop));
+			//}
+		}
+
+		mono_domain_unload(loadingDomain);
+	}
+
+	void ScriptEngine::LoadClassFields(ScriptClass& scriptClass, MonoClass* entityClass, MonoDomain* loadingDomain)
+	{
+		MonoClass* monoClass = scriptClass._monoClass;
+		int fieldCounts = mono_class_num_fields(monoClass);
+		HZ_CORE_LINFO("Class {0}", scriptClass._className);
+		HZ_CORE_LDEBUG("  {0} fields: ", fieldCounts);
+
+		// Default values are read from a single instance of the class.
+		MonoObject* monoObject = nullptr;
+		void* iterator = nullptr;
+
+		while (MonoClassField* field = mono_class_get_fields(monoClass, &iterator))
+		{
+			const auto type = mono_type_get_underlying_type(mono_field_get_type(field));
+			auto scriptFieldType = Utils::MonoTypeToScriptFieldType(type);
 
-				if (scriptFieldType == ScriptFieldType::None && mono_type_get_type(type) == MONO_TYPE_CLASS)
+			if (scriptFieldType == ScriptFieldType::None && mono_type_get_type(type) == MONO_TYPE_CLASS)
+			{
+				if (auto* typeMonoClass = mono_type_get_class(type))
 				{
-					if (auto* typeMonoClass = mono_type_get_class(type))
+					if (mono_class_is_subclass_of(typeMonoClass, entityClass, false))
 					{
-						if (mono_class_is_subclass_of(typeMonoClass, entityClass, false))
-						{
-							scriptFieldType = ScriptFieldType::Entity;
-						}
+						scriptFieldType = ScriptFieldType::Entity;
 					}
 				}
+			}
 
-				const auto typeName = scriptFieldType == ScriptFieldType::None ? mono_type_get_name(type) : Utils::ScriptFieldTypeToString(scriptFieldType);
-				const auto fieldName = mono_field_get_name(field);
-				const auto flags = mono_field_get_flags(field);
+			const auto typeName = scriptFieldType == ScriptFieldType::None ? mono_type_get_name(type) : Utils::ScriptFieldTypeToString(scriptFieldType);
+			const auto fieldName = mono_field_get_name(field);
+			const auto flags = mono_field_get_flags(field);
 
-				const auto accessibility = flags & FIELD_ATTRIBUTE_FIELD_ACCESS_MASK;
+			const auto accessibility = flags & FIELD_ATTRIBUTE_FIELD_ACCESS_MASK;
 
-				std::string extraAttribute;
-				switch (flags & ~FIELD_ATTRIBUTE_FIELD_ACCESS_MASK)
-				{
-				case FIELD_ATTRIBUTE_STATIC:
-					extraAttribute = "static";
-					break;
-				case FIELD_ATTRIBUTE_INIT_ONLY:
-					extraAttribute = "readonly";
-					break;
-				default:
-					break;
-				}
+			std::string extraAttribute;
+			switch (flags & ~FIELD_ATTRIBUTE_FIELD_ACCESS_MASK)
+			{
+			case FIELD_ATTRIBUTE_STATIC:
+				extraAttribute = "static";
+				break;
+			case FIELD_ATTRIBUTE_INIT_ONLY:
+				extraAttribute = "readonly";
+				break;
+			default:
+				break;
+			}
 
-				std::string accessModifier;
-				switch (accessibility)
-				{
-				case FIELD_ATTRIBUTE_PUBLIC:
-					accessModifier = "public";
-					break;
-				case FIELD_ATTRIBUTE_FAMILY:
-					accessModifier = "protected";
-					break;
-				case FIELD_ATTRIBUTE_ASSEMBLY:
-					accessModifier = "internal";
-					break;
-				case FIELD_ATTRIBUTE_PRIVATE:
-					accessModifier = "private";
-					break;
-				default:
-					accessModifier = "UNKNOWN";
-					break;
-				}
+			std::string accessModifier;
+			switch (accessibility)
+			{
+			case FIELD_ATTRIBUTE_PUBLIC:
+				accessModifier = "public";
+				break;
+			case FIELD_ATTRIBUTE_FAMILY:
+				accessModifier = "protected";
+				break;
+			case FIELD_ATTRIBUTE_ASSEMBLY:
+				accessModifier = "internal";
+				break;
+			case FIELD_ATTRIBUTE_PRIVATE:
+				accessModifier = "private";
+				break;
+			default:
+				accessModifier = "UNKNOWN";
+				break;
+			}
 
-				HZ_CORE_LTRACE("    {0} {1} {2} ({3})", extraAttribute, accessModifier, fieldName, typeName);
+			HZ_CORE_LTRACE("    {0} {1} {2} ({3})", extraAttribute, accessModifier, fieldName, typeName);
 
-				if (extraAttribute.empty() && accessibility == FIELD_ATTRIBUTE_PUBLIC)
-				{
-					// TODO Revisit defaultFieldValue
-					// should we keep a copy of the default value in ScriptField?
-					// Since ScriptFieldInstance has a copy of ScriptField.
+			if (extraAttribute.empty() && accessibility == FIELD_ATTRIBUTE_PUBLIC)
+			{
+				// TODO Revisit defaultFieldValue
+				// should we keep a copy of the default value in ScriptField?
+				// Since ScriptFieldInstance has a copy of ScriptField.
 
-					static uint8_t defaultFieldDataBuffer[16];
-					memset(defaultFieldDataBuffer, 0, sizeof(defaultFieldDataBuffer));
+				static uint8_t defaultFieldDataBuffer[16];
+				memset(defaultFieldDataBuffer, 0, sizeof(defaultFieldDataBuffer));
 
-					MonoObject* monoObject = mono_object_new(loadingDomain, monoClass);
+				if (!monoObject)
+				{
+					monoObject = mono_object_new(loadingDomain, monoClass);
 					mono_runtime_object_init(monoObject);
+				}
 
-					ScriptField scriptField = {scriptFieldType, fieldName, field};
+				ScriptField scriptField = {scriptFieldType, fieldName, field};
 
-					switch (scriptFieldType)
-					{
-					case ScriptFieldType::String:
-					{
-						if (MonoObject* monoStringObject = mono_field_get_value_object(loadingDomain, field, monoObject))
-						{
-							MonoString* monoString = reinterpret_cast<MonoString*>(monoStringObject);
-							auto* stringValue = mono_string_to_utf8(monoString);
-							scriptField.DefaultStringData = stringValue;
-							mono_free(stringValue);
-						}
-						break;
-					}
-					case ScriptFieldType::Entity:
-					{
-						// Do nothing leave data buffer at 0
-						break;
-					}
-					default: // All other types.
+				switch (scriptFieldType)
+				{
+				case ScriptFieldType::String:
+				{
+					if (MonoObject* monoStringObject = mono_field_get_value_object(loadingDomain, field, monoObject))
 					{
-						mono_field_get_value(monoObject, field, defaultFieldDataBuffer);
-						memcpy_s(scriptField.DefaultData, sizeof(scriptField.DefaultData), defaultFieldDataBuffer, sizeof(defaultFieldDataBuffer));
-						break;
+						MonoString* monoString = reinterpret_cast<MonoString*>(monoStringObject);
+						auto* stringValue = mono_string_to_utf8(monoString);
+						scriptField.DefaultStringData = stringValue;
+						mono_free(stringValue);
 					}
-					}
-
-					scriptClass->_fields[fieldName] = scriptField;
+					break;
+				}
+				case ScriptFieldType::Entity:
+				{
+					// Do nothing leave data buffer at 0
+					break;
+				}
+				default: // All other types.
+				{
+					mono_field_get_value(monoObject, field, defaultFieldDataBuffer);
+					memcpy_s(scriptField.DefaultData, sizeof(scriptField.DefaultData), defaultFieldDataBuffer, sizeof(defaultFieldDataBuffer));
+					break;
+				}
 				}
-			}
 
-			// TODO Revisit property
-			//int propertyCounts = mono_class_num_properties(monoClass);
-			//HZ_CORE_LDEBUG("  {0} properties: ", propertyCounts);
-			//iterator = nullptr;
-			//while (MonoProperty* prop = mono_class_get_properties(monoClass, &iterator))
-			//{
-			//	HZ_CORE_LTRACE("    {0}", mono_property_get_name(prop));
-			//}
+				scriptClass.AddField(scriptField);
+			}
 		}
-
-		mono_domain_unload(loadingDomain);
 	}
 
 	MonoObject* ScriptEngine::InstanciateClass(MonoClass* monoClass, MonoMethod* constructor, void** params)
@@ -731,6 +836,56 @@ namespace Hazel
 		return sScriptData->EntityBaseClass;
 	}
 
+	void ScriptEngine::RegisterUpdate(const Ref<ScriptInstance>& instance)
+	{
+		if (sScriptData->RegisterUpdateThunk && instance->GetScriptClass()->_onUpdateMethod)
+		{
+			MonoException* exception = nullptr;
+			sScriptData->RegisterUpdateThunk(instance->GetInstance(), &exception);
+			LogException(reinterpret_cast<MonoObject*>(exception));
+		}
+	}
+
+	void ScriptEngine::UnregisterUpdate(const Ref<ScriptInstance>& instance)
+	{
+		if (sScriptData->UnregisterUpdateThunk && instance->GetScriptClass()->_onUpdateMethod)
+		{
+			MonoException* exception = nullptr;
+			sScriptData->UnregisterUpdateThunk(instance->GetInstance(), &exception);
+			LogException(reinterpret_cast<MonoObject*>(exception));
+		}
+	}
+
+	void ScriptEngine::ClearUpdates()
+	{
+		if (sScriptData->ClearUpdatesThunk)
+		{
+			MonoException* exception = nullptr;
+			sScriptData->ClearUpdatesThunk(&exception);
+			LogException(reinterpret_cast<MonoObject*>(exception));
+		}
+	}
+
+	void ScriptEngine::LogException(MonoObject* exception)
+	{
+		if (!exception)
+		{
+			return;
+		}
+
+		MonoObject* toStringException = nullptr;
+		MonoString* message = mono_object_to_string(exception, &toStringException);
+		if (!message || toStringException)
+		{
+			HZ_CORE_LERROR("Script exception {0}", mono_class_get_name(mono_object_get_class(exception)));
+			return;
+		}
+
+		auto* messageValue = mono_string_to_utf8(message);
+		HZ_CORE_LERROR("Script exception {0}", messageValue);
+		mono_free(messageValue);
+	}
+
 	bool ScriptEngine::IsBaseClass(const MonoClass* monoClass)
 	{
 		return monoClass == GetEntityClass()->_monoClass;
@@ -762,4 +917,144 @@ namespace Hazel
 
 		return false;
 	}
+
+	template<typename Function>
+	void ScriptEngine::RunInstanceBenchmark(const Ref<ScriptClass>& benchmarkClass, uint32_t instanceCount, uint32_t iterations, Function run)
+	{
+		// The managed instances keep the UUID and handle of their entity, the scene is never run.
+		auto scene = CreateRef<Scene>("Script Benchmark");
+		std::vector<Ref<ScriptInstance>> instances;
+		instances.reserve(instanceCount);
+		for (uint32_t i = 0; i < instanceCount; i++)
+		{
+			instances.push_back(CreateRef<ScriptInstance>(benchmarkClass, scene->CreateEntity()));
+		}
+
+		auto measure = [&](auto invoke)
+		{
+			return Timer::MeasureFastestMillis(iterations, [&]()
+			{
+				for (const auto& instance : instances)
+				{
+					invoke(*instance);
+				}
+			});
+		};
+
+		run(instances, measure);
+	}
+
+	ScriptEngine::UpdateBenchmark ScriptEngine::RunUpdateBenchmark(uint32_t instanceCount, uint32_t iterations)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		UpdateBenchmark result;
+		result.InstanceCount = instanceCount;
+
+		if (sScriptData->SceneContext)
+		{
+			HZ_CORE_LERROR("Script update benchmark can't run while a scene is running");
+			return result;
+		}
+
+		const auto benchmarkClass = CreateRef<ScriptClass>("Hazel", "UpdateBenchmark", true);
+		if (!benchmarkClass->_monoClass || !benchmarkClass->_onUpdateThunk)
+		{
+			HZ_CORE_LERROR("Script update benchmark needs Hazel.UpdateBenchmark from the core assembly");
+			return result;
+		}
+
+		RunInstanceBenchmark(benchmarkClass, instanceCount, iterations, [&](const auto& instances, auto measure)
+		{
+			constexpr float timestep = 1.0f / 60.0f;
+			result.RuntimeInvokeMillis = measure([&](const ScriptInstance& instance)
+			{
+				float param = timestep;
+				void* params = &param;
+				benchmarkClass->InvokeMethod(instance._instance, benchmarkClass->_onUpdateMethod, &params);
+			});
+			result.ThunkMillis = measure([&](ScriptInstance& instance) { instance.InvokeOnUpdate(timestep); });
+
+			if (sScriptData->DispatchUpdateThunk)
+			{
+				for (const auto& instance : instances)
+				{
+					RegisterUpdate(instance);
+				}
+
+				result.DispatcherMillis = Timer::MeasureFastestMillis(iterations, [&]() { OnUpdateEntities(timestep); });
+
+				ClearUpdates();
+			}
+		});
+
+		const float toNanosPerCall = instanceCount > 0 ? 1000000.0f / instanceCount : 0.0f;
+		HZ_CORE_LINFO("OnUpdate of {0} scripts: mono_runtime_invoke {1}ms ({2}ns per call), unmanaged thunk {3}ms ({4}ns per call), dispatcher {5}ms ({6}ns per script)",
+			instanceCount, result.RuntimeInvokeMillis, result.RuntimeInvokeMillis * toNanosPerCall, result.ThunkMillis, result.ThunkMillis * toNanosPerCall,
+			result.DispatcherMillis, result.DispatcherMillis * toNanosPerCall);
+
+		return result;
+	}
+
+	ScriptEngine::FieldBenchmark ScriptEngine::RunFieldBenchmark(uint32_t instanceCount, uint32_t iterations)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		FieldBenchmark result;
+		result.InstanceCount = instanceCount;
+
+		if (sScriptData->SceneContext)
+		{
+			HZ_CORE_LERROR("Script field benchmark can't run while a scene is running");
+			return result;
+		}
+
+		const auto benchmarkClass = CreateRef<ScriptClass>("Hazel", "FieldBenchmark", true);
+		if (!benchmarkClass->_monoClass)
+		{
+			HZ_CORE_LERROR("Script field benchmark needs Hazel.FieldBenchmark from the core assembly");
+			return result;
+		}
+
+		MonoClass* entityClass = mono_class_from_name(sScriptData->CoreAssemblyImage, "Hazel", "Entity");
+		LoadClassFields(*benchmarkClass, entityClass, sScriptData->AppDomain);
+		result.FieldCount = benchmarkClass->GetFieldCount();
+
+		// Saved values as the editor stores them, every field set to its default.
+		ScriptFieldMap fieldMap;
+		for (uint32_t i = 0; i < result.FieldCount; i++)
+		{
+			const auto& field = benchmarkClass->GetField(i);
+			auto& fieldInstance = fieldMap[field.Name];
+			fieldInstance.Field = field;
+			memcpy(fieldInstance._dataBuffer, field.DefaultData, sizeof(fieldInstance._dataBuffer));
+		}
+
+		RunInstanceBenchmark(benchmarkClass, instanceCount, iterations, [&](const auto& instances, auto measure)
+		{
+			// As fields were copied before, a by name lookup and a ScriptField copy per value.
+			result.LookupMillis = measure([&](ScriptInstance& instance)
+			{
+				const auto& fields = benchmarkClass->GetFields();
+				for (const auto& [name, fieldInstance] : fieldMap)
+				{
+					const auto it = fields.find(name);
+					if (it == fields.end())
+					{
+						continue;
+					}
+
+					const ScriptField field = it->second;
+					mono_field_set_value(instance._instance, field.MonoClassField, const_cast<uint8_t*>(fieldInstance._dataBuffer));
+				}
+			});
+			result.AccessorMillis = measure([&](ScriptInstance& instance) { InitializeFields(instance, fieldMap); });
+		});
+
+		const float toNanosPerField = instanceCount > 0 && result.FieldCount > 0 ? 1000000.0f / (instanceCount * result.FieldCount) : 0.0f;
+		HZ_CORE_LINFO("Fields of {0} scripts with {1} fields: lookup {2}ms ({3}ns per field), accessor {4}ms ({5}ns per field)",
+			instanceCount, result.FieldCount, result.LookupMillis, result.LookupMillis * toNanosPerField, result.AccessorMillis, result.AccessorMillis * toNanosPerField);
+
+		return result;
+	}
 }
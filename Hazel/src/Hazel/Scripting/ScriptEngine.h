@@ -13,6 +13,7 @@ extern "C" // Forward declare of class from C
 	typedef struct _MonoImage MonoImage;
 	typedef struct _MonoAssemblyName MonoAssemblyName;
 	typedef struct _MonoClassField MonoClassField;
+	typedef struct _MonoDomain MonoDomain;
 }
 
 namespace Hazel
@@ -35,6 +36,11 @@ namespace Hazel
 		static Ref<ScriptInstance> OnCreateEntity(Entity entity);
 		static void OnDestroyEntity(Entity entity);
 		static void OnUpdateEntity(Entity entity, Timestep timestep);
+		// Batched updates, every instance updated by Hazel.ScriptUpdateDispatcher in a single call.
+		static void OnUpdateEntities(Timestep timestep);
+
+		static void SetBatchedUpdatesEnabled(bool enabled);
+		static bool AreBatchedUpdatesEnabled();
 
 		static Scene* GetSceneContext();
 		static Ref<ScriptClass> GetEntityClass(const std::string& fullClassName);
@@ -42,6 +48,7 @@ namespace Hazel
 		static ScriptFieldMap& GetScriptFieldMap(Entity entity);
 		static void EraseFromScriptFieldMap(Entity entity);
 
+		static Ref<ScriptInstance> GetEntityScriptInstance(Entity entity);
 		static Ref<ScriptInstance> GetEntityScriptInstance(UUID entityID);
 
 		static bool IsBaseClass(const MonoClass* monoClass);
@@ -49,6 +56,28 @@ namespace Hazel
 		static bool IsSubClassOf(MonoClass* child, const std::string& parentFullClassName, bool shouldCheckInterface = false);
 		static bool IsSubClassOf(const std::string& childFullClassName, MonoClass* parent, bool shouldCheckInterface = false);
 
+		// Time to call OnUpdate once on every instance of a core benchmark script, in milliseconds.
+		struct UpdateBenchmark
+		{
+			uint32_t InstanceCount = 0;
+			float RuntimeInvokeMillis = 0.0f; // mono_runtime_invoke with boxed arguments.
+			float ThunkMillis = 0.0f; // Unmanaged thunk cached on the ScriptClass.
+			float DispatcherMillis = 0.0f; // Single call to the managed dispatcher.
+		};
+
+		static UpdateBenchmark RunUpdateBenchmark(uint32_t instanceCount = 10000, uint32_t iterations = 10);
+
+		// Time to copy saved values into every field of freshly created instances of a core benchmark script, in milliseconds.
+		struct FieldBenchmark
+		{
+			uint32_t InstanceCount = 0;
+			uint32_t FieldCount = 0;
+			float LookupMillis = 0.0f; // Field found by name on each copy, set through mono_field_set_value.
+			float AccessorMillis = 0.0f; // Field resolved once, value types written at their offset.
+		};
+
+		static FieldBenchmark RunFieldBenchmark(uint32_t instanceCount = 1000, uint32_t iterations = 10);
+
 	private:
 		static void InitMono();
 		static void ShutdownMono();
@@ -61,6 +90,7 @@ namespace Hazel
 		static bool TryLoadCoreAssembly(const std::filesystem::path& filePath);
 		static bool TryLoadAppAssembly(const std::filesystem::path& filePath);
 		static void LoadAssemblyClasses();
+		static void LoadClassFields(ScriptClass& scriptClass, MonoClass* entityClass, MonoDomain* loadingDomain);
 
 		static MonoObject* InstanciateClass(MonoClass* monoClass, MonoMethod* constructor = nullptr, void** params = nullptr);
 
@@ -68,6 +98,22 @@ namespace Hazel
 		static MonoImage* GetAppAssemblyImage();
 		static Ref<ScriptClass> GetEntityClass();
 
+		// Copies the saved values of the fields still on the instance class.
+		static void InitializeFields(ScriptInstance& instance, const ScriptFieldMap& fieldMap);
+
+		// Instances without OnUpdate are left out of the dispatcher.
+		static void RegisterUpdate(const Ref<ScriptInstance>& instance);
+		static void UnregisterUpdate(const Ref<ScriptInstance>& instance);
+		static void ClearUpdates();
+
+		// Creates instanceCount instances of benchmarkClass and calls run with them and a function measuring a call on every one of them,
+		// the fastest of iterations runs in milliseconds.
+		template<typename Function>
+		static void RunInstanceBenchmark(const Ref<ScriptClass>& benchmarkClass, uint32_t instanceCount, uint32_t iterations, Function run);
+
+		// Does nothing without exception.
+		static void LogException(MonoObject* exception);
+
 		friend class ScriptGlue;
 		friend class ScriptClass;
 		friend class ScriptInstance;
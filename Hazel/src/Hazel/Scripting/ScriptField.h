@@ -32,6 +32,11 @@ namespace Hazel
 		uint8_t DefaultData[16];
 		std::string DefaultStringData;
 
+		// Resolved when the class is loaded.
+		uint32_t Index = 0; // In ScriptClass::GetField(index).
+		uint32_t Offset = 0; // From the start of the managed object.
+		uint32_t Size = 0; // 0 for references, they are only written through mono for the GC write barrier.
+
 		template<typename T>
 		T GetDefaultValue() const
 		{
@@ -18,6 +18,57 @@ namespace Hazel
 	static std::unordered_map<MonoType*, std::function<bool(Entity)>> sEntityHasComponentFuncs;
 	static std::unordered_map<MonoType*, std::function<void(Entity)>> sEntityAddComponentFuncs;
 
+	// Managed entities pass their handle along with their UUID, a direct registry index instead of a UUID lookup.
+	static Entity GetEntity(UUID entityId, entt::entity entityHandle)
+	{
+		auto* scene = ScriptEngine::GetSceneContext();
+		HZ_CORE_ASSERT(scene, "Scene is null!");
+		return scene->GetEntityByHandle(entityHandle, entityId);
+	}
+
+	// Batched calls take parallel id, handle and value arrays filled by Hazel.EntityGroup, one call for the whole group.
+	// The handle version tells destroyed entities apart, they are skipped along with those missing the component.
+	// Returns the number of entities processed, func may return false to leave an entity out of it.
+	template<typename Component, typename Value, typename Func>
+	static int32_t ForEachBatchedComponent(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* values, Func func)
+	{
+		auto* scene = ScriptEngine::GetSceneContext();
+		HZ_CORE_ASSERT(scene, "Scene is null!");
+
+		if (count <= 0 || !entityIds || !entityHandles || !values)
+		{
+			return 0;
+		}
+
+		const uintptr_t length = std::min({static_cast<uintptr_t>(count), mono_array_length(entityIds), mono_array_length(entityHandles), mono_array_length(values)});
+		const auto* ids = mono_array_addr(entityIds, uint64_t, 0);
+		const auto* handles = mono_array_addr(entityHandles, entt::entity, 0);
+		auto* valueData = mono_array_addr(values, Value, 0);
+
+		int32_t processedCount = 0;
+		for (uintptr_t i = 0; i < length; i++)
+		{
+			const auto entity = scene->GetEntityByHandle(handles[i], ids[i]);
+			if (!entity || !entity.HasComponent<Component>())
+			{
+				continue;
+			}
+
+			auto& component = entity.GetComponent<Component>();
+			if constexpr (std::is_void_v<decltype(func(entity, component, valueData[i]))>)
+			{
+				func(entity, component, valueData[i]);
+				processedCount++;
+			}
+			else
+			{
+				processedCount += func(entity, component, valueData[i]) ? 1 : 0;
+			}
+		}
+
+		return processedCount;
+	}
+
 	/////////////////
 	/// Logger
 	/////////////////
@@ -111,11 +162,11 @@ namespace Hazel
 	/////////////////
 
 #pragma region Entity
-	static bool Entity_IsValid(UUID entityId)
+	static bool Entity_IsValid(UUID entityId, entt::entity entityHandle)
 	{
 		if (auto* scene = ScriptEngine::GetSceneContext())
 		{
-			return scene->GetEntityByUUID(entityId);
+			return scene->GetEntityByHandle(entityHandle, entityId);
 		}
 
 		return false;
@@ -139,12 +190,12 @@ namespace Hazel
 		}
 	}
 
-	static bool Entity_Destroy(UUID entityId)
+	static bool Entity_Destroy(UUID entityId, entt::entity entityHandle)
 	{
 		auto* scene = ScriptEngine::GetSceneContext();
 		HZ_CORE_ASSERT(scene, "Scene is null!");
 
-		if (const auto entity = scene->GetEntityByUUID(entityId))
+		if (const auto entity = scene->GetEntityByHandle(entityHandle, entityId))
 		{
 			scene->DestroyEntity(entity);
 			return true;
@@ -166,7 +217,7 @@ namespace Hazel
 
 		if (foundEntity)
 		{
-			if (const auto& entityScriptInstance = ScriptEngine::GetEntityScriptInstance(foundEntity.GetUUID()))
+			if (const auto& entityScriptInstance = ScriptEngine::GetEntityScriptInstance(foundEntity))
 			{
 				*outEntity = entityScriptInstance->GetInstance();
 				return true;
@@ -182,11 +233,9 @@ namespace Hazel
 		return false;
 	}
 
-	static void Entity_AddComponent(UUID entityId, MonoReflectionType* componentType)
+	static void Entity_AddComponent(UUID entityId, entt::entity entityHandle, MonoReflectionType* componentType)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto* managedType = mono_reflection_type_get_type(componentType);
@@ -195,11 +244,9 @@ namespace Hazel
 		sEntityAddComponentFuncs[managedType](entity);
 	}
 
-	static bool Entity_HasComponent(UUID entityId, MonoReflectionType* componentType)
+	static bool Entity_HasComponent(UUID entityId, entt::entity entityHandle, MonoReflectionType* componentType)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto* managedType = mono_reflection_type_get_type(componentType);
@@ -208,7 +255,7 @@ namespace Hazel
 		return sEntityHasComponentFuncs[managedType](entity);
 	}
 
-	static void Entity_GetName(UUID entityId, MonoString** outName)
+	static void Entity_GetName(UUID entityId, entt::entity entityHandle, MonoString** outName)
 	{
 		if (!HZ_CORE_ENSURE_MSG(Application::IsMainThread(), "Entity_GetName can only be called from the Main Thread!"))
 		{
@@ -222,7 +269,7 @@ namespace Hazel
 			return;
 		}
 
-		if (const auto entity = scene->GetEntityByUUID(entityId))
+		if (const auto entity = scene->GetEntityByHandle(entityHandle, entityId))
 		{
 			*outName = mono_string_new_wrapper(entity.Name().c_str());
 			return;
@@ -231,7 +278,7 @@ namespace Hazel
 		HZ_CORE_LERROR("Entity {0} not found.", entityId);
 	}
 
-	static void Entity_SetName(UUID entityId, MonoString* name)
+	static void Entity_SetName(UUID entityId, entt::entity entityHandle, MonoString* name)
 	{
 		if (!HZ_CORE_ENSURE_MSG(Application::IsMainThread(), "Entity_SetName can only be called from the Main Thread!"))
 		{
@@ -244,7 +291,7 @@ namespace Hazel
 			return;
 		}
 
-		if (const auto entity = scene->GetEntityByUUID(entityId))
+		if (const auto entity = scene->GetEntityByHandle(entityHandle, entityId))
 		{
 			auto* entityName = mono_string_to_utf8(name);
 			entity.Name() = entityName;
@@ -262,28 +309,22 @@ namespace Hazel
 
 #pragma region Components
 #pragma region Transform
-	static void TransformComponent_GetPosition(UUID entityId, glm::vec3* outPosition)
+	static void TransformComponent_GetPosition(UUID entityId, entt::entity entityHandle, glm::vec3* outPosition)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		*outPosition = entity.Transform().Position;
 	}
 
-	static void TransformComponent_SetPosition(UUID entityId, glm::vec3* position)
+	// Moves the audio attached to the entity along.
+	static void SetEntityPosition(Entity entity, const glm::vec3& position)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
-		HZ_CORE_ASSERT(entity, "Entity is null!");
-
-		entity.Transform().Position = *position;
+		entity.Transform().Position = position;
 
 		if (entity.HasComponent<AudioListenerComponent>())
 		{
-			AudioEngine::SetListenerPosition(*position);
+			AudioEngine::SetListenerPosition(position);
 		}
 
 		if (entity.HasComponent<AudioSourceComponent>())
@@ -293,59 +334,93 @@ namespace Hazel
 			{
 				if (source->Get3D())
 				{
-					source->SetPosition(*position);
+					source->SetPosition(position);
 				}
 			}
 		}
 	}
 
-	static void TransformComponent_GetRotation(UUID entityId, glm::vec3* outRotation)
+	static void TransformComponent_SetPosition(UUID entityId, entt::entity entityHandle, glm::vec3* position)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
+		HZ_CORE_ASSERT(entity, "Entity is null!");
+
+		SetEntityPosition(entity, *position);
+	}
+
+	static void TransformComponent_GetRotation(UUID entityId, entt::entity entityHandle, glm::vec3* outRotation)
+	{
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		*outRotation = glm::degrees(entity.Transform().Rotation);
 	}
 
-	static void TransformComponent_SetRotation(UUID entityId, glm::vec3* rotation)
+	static void TransformComponent_SetRotation(UUID entityId, entt::entity entityHandle, glm::vec3* rotation)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		entity.Transform().Rotation = glm::radians(*rotation);
 	}
 
-	static void TransformComponent_GetScale(UUID entityId, glm::vec3* outScale)
+	static void TransformComponent_GetScale(UUID entityId, entt::entity entityHandle, glm::vec3* outScale)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		*outScale = entity.Transform().Scale;
 	}
 
-	static void TransformComponent_SetScale(UUID entityId, glm::vec3* scale)
+	static void TransformComponent_SetScale(UUID entityId, entt::entity entityHandle, glm::vec3* scale)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		entity.Transform().Scale = *scale;
 	}
+
+	static int32_t TransformComponent_GetPositions(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* outPositions)
+	{
+		return ForEachBatchedComponent<TransformComponent, glm::vec3>(entityIds, entityHandles, count, outPositions,
+			[](Entity, const TransformComponent& component, glm::vec3& outPosition) { outPosition = component.Position; });
+	}
+
+	static int32_t TransformComponent_SetPositions(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* positions)
+	{
+		return ForEachBatchedComponent<TransformComponent, glm::vec3>(entityIds, entityHandles, count, positions,
+			[](Entity entity, TransformComponent&, const glm::vec3& position) { SetEntityPosition(entity, position); });
+	}
+
+	static int32_t TransformComponent_GetRotations(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* outRotations)
+	{
+		return ForEachBatchedComponent<TransformComponent, glm::vec3>(entityIds, entityHandles, count, outRotations,
+			[](Entity, const TransformComponent& component, glm::vec3& outRotation) { outRotation = glm::degrees(component.Rotation); });
+	}
+
+	static int32_t TransformComponent_SetRotations(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* rotations)
+	{
+		return ForEachBatchedComponent<TransformComponent, glm::vec3>(entityIds, entityHandles, count, rotations,
+			[](Entity, TransformComponent& component, const glm::vec3& rotation) { component.Rotation = glm::radians(rotation); });
+	}
+
+	static int32_t TransformComponent_GetScales(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* outScales)
+	{
+		return ForEachBatchedComponent<TransformComponent, glm::vec3>(entityIds, entityHandles, count, outScales,
+			[](Entity, const TransformComponent& component, glm::vec3& outScale) { outScale = component.Scale; });
+	}
+
+	static int32_t TransformComponent_SetScales(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* scales)
+	{
+		return ForEachBatchedComponent<TransformComponent, glm::vec3>(entityIds, entityHandles, count, scales,
+			[](Entity, TransformComponent& component, const glm::vec3& scale) { component.Scale = scale; });
+	}
 #pragma endregion
 
 #pragma region Camera
-	static void CameraComponent_GetIsPrimary(UUID entityId, bool* isPrimary)
+	static void CameraComponent_GetIsPrimary(UUID entityId, entt::entity entityHandle, bool* isPrimary)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<CameraComponent>();
@@ -353,11 +428,9 @@ namespace Hazel
 		*isPrimary = component.IsPrimary;
 	}
 
-	static void CameraComponent_SetIsPrimary(UUID entityId, bool* isPrimary)
+	static void CameraComponent_SetIsPrimary(UUID entityId, entt::entity entityHandle, bool* isPrimary)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<CameraComponent>();
@@ -365,11 +438,9 @@ namespace Hazel
 		component.IsPrimary = *isPrimary;
 	}
 
-	static void CameraComponent_GetIsFixedAspectRatio(UUID entityId, bool* isFixedAspectRatio)
+	static void CameraComponent_GetIsFixedAspectRatio(UUID entityId, entt::entity entityHandle, bool* isFixedAspectRatio)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<CameraComponent>();
@@ -377,22 +448,18 @@ namespace Hazel
 		*isFixedAspectRatio = component.IsFixedAspectRatio;
 	}
 
-	static void CameraComponent_SetIsFixedAspectRatio(UUID entityId, bool* isFixedAspectRatio)
+	static void CameraComponent_SetIsFixedAspectRatio(UUID entityId, entt::entity entityHandle, bool* isFixedAspectRatio)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<CameraComponent>();
 
 		component.IsFixedAspectRatio = *isFixedAspectRatio;
 	}
-	static void CameraComponent_GetOrthographicSize(UUID entityId, float* size)
+	static void CameraComponent_GetOrthographicSize(UUID entityId, entt::entity entityHandle, float* size)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<CameraComponent>();
@@ -400,11 +467,9 @@ namespace Hazel
 		*size = component.Camera.GetOrthographicSize();
 	}
 
-	static void CameraComponent_SetOrthographicSize(UUID entityId, float* size)
+	static void CameraComponent_SetOrthographicSize(UUID entityId, entt::entity entityHandle, float* size)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<CameraComponent>();
@@ -418,11 +483,9 @@ namespace Hazel
 
 	// TODO Add sprite/texture class to C#
 
-	static void SpriteRendererComponent_GetTiling(UUID entityId, glm::vec2* outTiling)
+	static void SpriteRendererComponent_GetTiling(UUID entityId, entt::entity entityHandle, glm::vec2* outTiling)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<SpriteRendererComponent>();
@@ -430,23 +493,20 @@ namespace Hazel
 		*outTiling = component.Tiling;
 	}
 
-	static void SpriteRendererComponent_SetTiling(UUID entityId, glm::vec3* tiling)
+	static void SpriteRendererComponent_SetTiling(UUID entityId, entt::entity entityHandle, glm::vec3* tiling)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<SpriteRendererComponent>();
 
 		component.Tiling = *tiling;
+		ScriptEngine::GetSceneContext()->InvalidateStaticSprite(entity);
 	}
 
-	static void SpriteRendererComponent_GetColor(UUID entityId, Color* outColor)
+	static void SpriteRendererComponent_GetColor(UUID entityId, entt::entity entityHandle, Color* outColor)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<SpriteRendererComponent>();
@@ -454,26 +514,39 @@ namespace Hazel
 		*outColor = component.Color;
 	}
 
-	static void SpriteRendererComponent_SetColor(UUID entityId, Color* color)
+	static void SpriteRendererComponent_SetColor(UUID entityId, entt::entity entityHandle, Color* color)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<SpriteRendererComponent>();
 
 		component.Color = *color;
+		ScriptEngine::GetSceneContext()->InvalidateStaticSprite(entity);
+	}
+
+	static int32_t SpriteRendererComponent_GetColors(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* outColors)
+	{
+		return ForEachBatchedComponent<SpriteRendererComponent, Color>(entityIds, entityHandles, count, outColors,
+			[](Entity, const SpriteRendererComponent& component, Color& outColor) { outColor = component.Color; });
+	}
+
+	static int32_t SpriteRendererComponent_SetColors(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* colors)
+	{
+		return ForEachBatchedComponent<SpriteRendererComponent, Color>(entityIds, entityHandles, count, colors,
+			[](Entity entity, SpriteRendererComponent& component, const Color& color)
+			{
+				component.Color = color;
+				ScriptEngine::GetSceneContext()->InvalidateStaticSprite(entity);
+			});
 	}
 #pragma endregion
 
 #pragma region CircleRenderer
 
-	static void CircleRendererComponent_GetColor(UUID entityId, Color* outColor)
+	static void CircleRendererComponent_GetColor(UUID entityId, entt::entity entityHandle, Color* outColor)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<CircleRendererComponent>();
@@ -481,11 +554,9 @@ namespace Hazel
 		*outColor = component.Color;
 	}
 
-	static void CircleRendererComponent_SetColor(UUID entityId, Color* color)
+	static void CircleRendererComponent_SetColor(UUID entityId, entt::entity entityHandle, Color* color)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<CircleRendererComponent>();
@@ -493,11 +564,9 @@ namespace Hazel
 		component.Color = *color;
 	}
 
-	static void CircleRendererComponent_GetThickness(UUID entityId, float* outThickness)
+	static void CircleRendererComponent_GetThickness(UUID entityId, entt::entity entityHandle, float* outThickness)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<CircleRendererComponent>();
@@ -505,11 +574,9 @@ namespace Hazel
 		*outThickness = component.Thickness;
 	}
 
-	static void CircleRendererComponent_SetThickness(UUID entityId, float* thickness)
+	static void CircleRendererComponent_SetThickness(UUID entityId, entt::entity entityHandle, float* thickness)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<CircleRendererComponent>();
@@ -517,11 +584,9 @@ namespace Hazel
 		component.Thickness = glm::clamp(*thickness, 0.0f, 1.0f);
 	}
 
-	static void CircleRendererComponent_GetFade(UUID entityId, float* outFade)
+	static void CircleRendererComponent_GetFade(UUID entityId, entt::entity entityHandle, float* outFade)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<CircleRendererComponent>();
@@ -529,11 +594,9 @@ namespace Hazel
 		*outFade = component.Fade;
 	}
 
-	static void CircleRendererComponent_SetFade(UUID entityId, float* fade)
+	static void CircleRendererComponent_SetFade(UUID entityId, entt::entity entityHandle, float* fade)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		auto& component = entity.GetComponent<CircleRendererComponent>();
@@ -543,11 +606,9 @@ namespace Hazel
 #pragma endregion
 
 #pragma region Rigibody2D
-	static void Rigidbody2DComponent_ApplyLinearImpulse(UUID entityId, glm::vec2* impulse, glm::vec2* worldPoint, bool wake)
+	static void Rigidbody2DComponent_ApplyLinearImpulse(UUID entityId, entt::entity entityHandle, glm::vec2* impulse, glm::vec2* worldPoint, bool wake)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<Rigidbody2DComponent>();
@@ -556,11 +617,9 @@ namespace Hazel
 		body->ApplyLinearImpulse(b2Vec2(impulse->x, impulse->y), b2Vec2(worldPoint->x, worldPoint->y), wake);
 	}
 
-	static void Rigidbody2DComponent_GetLinearVelocity(UUID entityId, glm::vec2* outLinearVelocity)
+	static void Rigidbody2DComponent_GetLinearVelocity(UUID entityId, entt::entity entityHandle, glm::vec2* outLinearVelocity)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<Rigidbody2DComponent>();
@@ -572,11 +631,9 @@ namespace Hazel
 		outLinearVelocity->y = linearVelocity.y;
 	}
 
-	static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(UUID entityId, glm::vec2* impulse, bool wake)
+	static void Rigidbody2DComponent_ApplyLinearImpulseToCenter(UUID entityId, entt::entity entityHandle, glm::vec2* impulse, bool wake)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<Rigidbody2DComponent>();
@@ -585,11 +642,9 @@ namespace Hazel
 		body->ApplyLinearImpulseToCenter(b2Vec2(impulse->x, impulse->y), wake);
 	}
 
-	static void Rigidbody2DComponent_ApplyAngularImpulse(UUID entityId, float impulse, bool wake)
+	static void Rigidbody2DComponent_ApplyAngularImpulse(UUID entityId, entt::entity entityHandle, float impulse, bool wake)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		const auto& component = entity.GetComponent<Rigidbody2DComponent>();
@@ -597,14 +652,46 @@ namespace Hazel
 
 		body->ApplyAngularImpulse(impulse, wake);
 	}
+
+	// Bodies only exist while the physics runs, entities without one are skipped.
+	static int32_t Rigidbody2DComponent_GetLinearVelocities(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* outLinearVelocities)
+	{
+		return ForEachBatchedComponent<Rigidbody2DComponent, glm::vec2>(entityIds, entityHandles, count, outLinearVelocities,
+			[](Entity, const Rigidbody2DComponent& component, glm::vec2& outLinearVelocity)
+			{
+				const auto* body = static_cast<b2Body*>(component.RuntimeBody);
+				if (!body)
+				{
+					return false;
+				}
+
+				const auto& linearVelocity = body->GetLinearVelocity();
+				outLinearVelocity = {linearVelocity.x, linearVelocity.y};
+				return true;
+			});
+	}
+
+	static int32_t Rigidbody2DComponent_SetLinearVelocities(MonoArray* entityIds, MonoArray* entityHandles, int32_t count, MonoArray* linearVelocities)
+	{
+		return ForEachBatchedComponent<Rigidbody2DComponent, glm::vec2>(entityIds, entityHandles, count, linearVelocities,
+			[](Entity, const Rigidbody2DComponent& component, const glm::vec2& linearVelocity)
+			{
+				auto* body = static_cast<b2Body*>(component.RuntimeBody);
+				if (!body)
+				{
+					return false;
+				}
+
+				body->SetLinearVelocity(b2Vec2(linearVelocity.x, linearVelocity.y));
+				return true;
+			});
+	}
 #pragma endregion
 
 #pragma region AudioListener
-	static void AudioListenerComponent_GetIsVisibleInGame(UUID entityId, bool* outIsVisibleInGame)
+	static void AudioListenerComponent_GetIsVisibleInGame(UUID entityId, entt::entity entityHandle, bool* outIsVisibleInGame)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -613,11 +700,9 @@ namespace Hazel
 		*outIsVisibleInGame = component.IsVisibleInGame;
 	}
 
-	static void AudioListenerComponent_SetIsVisibleInGame(UUID entityId, bool isVisibleInGame)
+	static void AudioListenerComponent_SetIsVisibleInGame(UUID entityId, entt::entity entityHandle, bool isVisibleInGame)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -627,11 +712,9 @@ namespace Hazel
 #pragma endregion
 
 #pragma region AudioSource
-	static void AudioSourceComponent_GetGain(UUID entityId, float* outGain)
+	static void AudioSourceComponent_GetGain(UUID entityId, entt::entity entityHandle, float* outGain)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -641,11 +724,9 @@ namespace Hazel
 		*outGain = component.AudioSource->GetGain();
 	}
 
-	static void AudioSourceComponent_SetGain(UUID entityId, float gain)
+	static void AudioSourceComponent_SetGain(UUID entityId, entt::entity entityHandle, float gain)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -655,11 +736,9 @@ namespace Hazel
 		component.AudioSource->SetGain(gain);
 	}
 
-	static void AudioSourceComponent_GetPitch(UUID entityId, float* outPitch)
+	static void AudioSourceComponent_GetPitch(UUID entityId, entt::entity entityHandle, float* outPitch)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -669,11 +748,9 @@ namespace Hazel
 		*outPitch = component.AudioSource->GetPitch();
 	}
 
-	static void AudioSourceComponent_SetPitch(UUID entityId, float pitch)
+	static void AudioSourceComponent_SetPitch(UUID entityId, entt::entity entityHandle, float pitch)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -683,11 +760,9 @@ namespace Hazel
 		component.AudioSource->SetPitch(pitch);
 	}
 
-	static void AudioSourceComponent_GetLoop(UUID entityId, bool* outIsLoop)
+	static void AudioSourceComponent_GetLoop(UUID entityId, entt::entity entityHandle, bool* outIsLoop)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -697,11 +772,9 @@ namespace Hazel
 		*outIsLoop = component.AudioSource->GetLoop();
 	}
 
-	static void AudioSourceComponent_SetLoop(UUID entityId, bool loop)
+	static void AudioSourceComponent_SetLoop(UUID entityId, entt::entity entityHandle, bool loop)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -711,11 +784,9 @@ namespace Hazel
 		component.AudioSource->SetLoop(loop);
 	}
 
-	static void AudioSourceComponent_Get3D(UUID entityId, bool* outIs3D)
+	static void AudioSourceComponent_Get3D(UUID entityId, entt::entity entityHandle, bool* outIs3D)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -725,11 +796,9 @@ namespace Hazel
 		*outIs3D = component.AudioSource->Get3D();
 	}
 
-	static void AudioSourceComponent_Set3D(UUID entityId, bool is3D)
+	static void AudioSourceComponent_Set3D(UUID entityId, entt::entity entityHandle, bool is3D)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -739,11 +808,9 @@ namespace Hazel
 		component.AudioSource->Set3D(is3D);
 	}
 
-	static void AudioSourceComponent_GetState(UUID entityId, int* outState)
+	static void AudioSourceComponent_GetState(UUID entityId, entt::entity entityHandle, int* outState)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -753,11 +820,9 @@ namespace Hazel
 		*outState = static_cast<int>(component.AudioSource->GetState());
 	}
 
-	static void AudioSourceComponent_GetOffset(UUID entityId, float* outOffset)
+	static void AudioSourceComponent_GetOffset(UUID entityId, entt::entity entityHandle, float* outOffset)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -767,11 +832,9 @@ namespace Hazel
 		*outOffset = component.AudioSource->GetOffset();
 	}
 
-	static void AudioSourceComponent_SetOffset(UUID entityId, float* offset)
+	static void AudioSourceComponent_SetOffset(UUID entityId, entt::entity entityHandle, float* offset)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -781,11 +844,9 @@ namespace Hazel
 		component.AudioSource->SetOffset(*offset);
 	}
 
-	static void AudioSourceComponent_GetLength(UUID entityId, float* outLenght)
+	static void AudioSourceComponent_GetLength(UUID entityId, entt::entity entityHandle, float* outLenght)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -795,11 +856,9 @@ namespace Hazel
 		*outLenght = component.AudioSource->GetLength();
 	}
 
-	static void AudioSourceComponent_GetPath(UUID entityId, MonoString** outPath)
+	static void AudioSourceComponent_GetPath(UUID entityId, entt::entity entityHandle, MonoString** outPath)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -809,11 +868,9 @@ namespace Hazel
 		*outPath = mono_string_new_wrapper(component.AudioSource->GetPath().string().c_str());
 	}
 
-	static void AudioSourceComponent_GetIsVisibleInGame(UUID entityId, bool* outIsVisibleInGame)
+	static void AudioSourceComponent_GetIsVisibleInGame(UUID entityId, entt::entity entityHandle, bool* outIsVisibleInGame)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -822,11 +879,9 @@ namespace Hazel
 		*outIsVisibleInGame = component.IsVisibleInGame;
 	}
 
-	static void AudioSourceComponent_SetIsVisibleInGame(UUID entityId, bool isVisibleInGame)
+	static void AudioSourceComponent_SetIsVisibleInGame(UUID entityId, entt::entity entityHandle, bool isVisibleInGame)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -834,11 +889,9 @@ namespace Hazel
 		component.IsVisibleInGame = isVisibleInGame;
 	}
 
-	static void AudioSourceComponent_Play(UUID entityId)
+	static void AudioSourceComponent_Play(UUID entityId, entt::entity entityHandle)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -848,11 +901,9 @@ namespace Hazel
 		component.AudioSource->Play();
 	}
 
-	static void AudioSourceComponent_Stop(UUID entityId)
+	static void AudioSourceComponent_Stop(UUID entityId, entt::entity entityHandle)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -862,11 +913,9 @@ namespace Hazel
 		component.AudioSource->Stop();
 	}
 
-	static void AudioSourceComponent_Pause(UUID entityId)
+	static void AudioSourceComponent_Pause(UUID entityId, entt::entity entityHandle)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -876,11 +925,9 @@ namespace Hazel
 		component.AudioSource->Pause();
 	}
 
-	static void AudioSourceComponent_Rewind(UUID entityId)
+	static void AudioSourceComponent_Rewind(UUID entityId, entt::entity entityHandle)
 	{
-		auto* scene = ScriptEngine::GetSceneContext();
-		HZ_CORE_ASSERT(scene, "Scene is null!");
-		const auto entity = scene->GetEntityByUUID(entityId);
+		const auto entity = GetEntity(entityId, entityHandle);
 		HZ_CORE_ASSERT(entity, "Entity is null!");
 
 		// Will crash if entity does not have component.
@@ -975,6 +1022,12 @@ namespace Hazel
 		HZ_ADD_INTERNAL_CALL(TransformComponent_SetRotation);
 		HZ_ADD_INTERNAL_CALL(TransformComponent_GetScale);
 		HZ_ADD_INTERNAL_CALL(TransformComponent_SetScale);
+		HZ_ADD_INTERNAL_CALL(TransformComponent_GetPositions);
+		HZ_ADD_INTERNAL_CALL(TransformComponent_SetPositions);
+		HZ_ADD_INTERNAL_CALL(TransformComponent_GetRotations);
+		HZ_ADD_INTERNAL_CALL(TransformComponent_SetRotations);
+		HZ_ADD_INTERNAL_CALL(TransformComponent_GetScales);
+		HZ_ADD_INTERNAL_CALL(TransformComponent_SetScales);
 #pragma endregion
 
 #pragma region Components
@@ -992,6 +1045,8 @@ namespace Hazel
 		HZ_ADD_INTERNAL_CALL(SpriteRendererComponent_SetTiling);
 		HZ_ADD_INTERNAL_CALL(SpriteRendererComponent_GetColor);
 		HZ_ADD_INTERNAL_CALL(SpriteRendererComponent_SetColor);
+		HZ_ADD_INTERNAL_CALL(SpriteRendererComponent_GetColors);
+		HZ_ADD_INTERNAL_CALL(SpriteRendererComponent_SetColors);
 #pragma endregion
 
 #pragma region Circle Renderer
@@ -1008,6 +1063,8 @@ namespace Hazel
 		HZ_ADD_INTERNAL_CALL(Rigidbody2DComponent_GetLinearVelocity);
 		HZ_ADD_INTERNAL_CALL(Rigidbody2DComponent_ApplyLinearImpulseToCenter);
 		HZ_ADD_INTERNAL_CALL(Rigidbody2DComponent_ApplyAngularImpulse);
+		HZ_ADD_INTERNAL_CALL(Rigidbody2DComponent_GetLinearVelocities);
+		HZ_ADD_INTERNAL_CALL(Rigidbody2DComponent_SetLinearVelocities);
 #pragma endregion
 
 #pragma region Audio Listener
@@ -10,155 +10,137 @@ namespace Hazel
 		: _scriptClass(scriptClass)
 	{
 		// Base constructor
-		_constructor = ScriptEngine::GetEntityClass()->GetMethod(".ctor", 1);
-
-		_onCreateMethod = scriptClass->GetMethod("OnCreate");
-		_onDestroyMethod = scriptClass->GetMethod("OnDestroy");
-		_onUpdateMethod = scriptClass->GetMethod("OnUpdate", 1);
+		_constructor = ScriptEngine::GetEntityClass()->GetMethod(".ctor", 2);
 
 		// Call Entity Constructor
 		auto entityId = entity.GetUUID();
-		void* param = &entityId;
-		_instance = scriptClass->Instanciate(_constructor, &param);
+		auto entityHandle = static_cast<uint32_t>(entity);
+		void* params[] = {&entityId, &entityHandle};
+		_instance = scriptClass->Instanciate(_constructor, params);
+		_gcHandle = mono_gchandle_new(_instance, true);
+	}
+
+	ScriptInstance::~ScriptInstance()
+	{
+		mono_gchandle_free(_gcHandle);
 	}
 
 	void ScriptInstance::InvokeOnCreate()
 	{
-		if (_onCreateMethod)
+		if (const auto onCreate = _scriptClass->_onCreateThunk)
 		{
-			_scriptClass->InvokeMethod(_instance, _onCreateMethod);
+			MonoException* exception = nullptr;
+			onCreate(_instance, &exception);
+			ScriptEngine::LogException(reinterpret_cast<MonoObject*>(exception));
 		}
 	}
 
 	void ScriptInstance::InvokeOnDestroy()
 	{
-		if (_onDestroyMethod)
+		if (const auto onDestroy = _scriptClass->_onDestroyThunk)
 		{
-			_scriptClass->InvokeMethod(_instance, _onDestroyMethod);
+			MonoException* exception = nullptr;
+			onDestroy(_instance, &exception);
+			ScriptEngine::LogException(reinterpret_cast<MonoObject*>(exception));
 		}
 	}
 
 	void ScriptInstance::InvokeOnUpdate(float timestep)
 	{
-		if (_onUpdateMethod)
+		if (const auto onUpdate = _scriptClass->_onUpdateThunk)
 		{
-			void* param = &timestep;
-			_scriptClass->InvokeMethod(_instance, _onUpdateMethod, &param);
+			MonoException* exception = nullptr;
+			onUpdate(_instance, timestep, &exception);
+			ScriptEngine::LogException(reinterpret_cast<MonoObject*>(exception));
 		}
 	}
 
-	bool ScriptInstance::TryGetFieldValueInternal(const std::string& name, void* data) const
+	const ScriptField* ScriptInstance::FindField(const std::string& name) const
 	{
-		ScriptField field;
-		if (TryGetField(name, field))
-		{
-			mono_field_get_value(_instance, field.MonoClassField, data);
-			return true;
-		}
-
-		return false;
+		return _scriptClass->GetField(name);
 	}
 
-	bool ScriptInstance::TrySetFieldValueInternal(const std::string& name, const void* data) const
+	void ScriptInstance::GetFieldValueInternal(const ScriptField& field, void* data) const
 	{
-		ScriptField field;
-		if (TryGetField(name, field))
+		if (field.Size > 0)
 		{
-			mono_field_set_value(_instance, field.MonoClassField, const_cast<void*>(data));
-			return true;
+			memcpy(data, reinterpret_cast<const uint8_t*>(_instance) + field.Offset, field.Size);
+			return;
 		}
 
-		return false;
+		mono_field_get_value(_instance, field.MonoClassField, data);
 	}
 
-	bool ScriptInstance::TryGetFieldStringValueInternal(const std::string& name, std::string& data) const
+	void ScriptInstance::SetFieldValueInternal(const ScriptField& field, const void* data) const
 	{
-		ScriptField field;
-		if (TryGetField(name, field))
+		if (field.Size > 0)
 		{
-			if (auto* monoString = reinterpret_cast<MonoString*>(mono_field_get_value_object(mono_object_get_domain(_instance), field.MonoClassField, _instance)))
-			{
-				auto* charData = mono_string_to_utf8(monoString);
-				data = charData;
-				mono_free(charData);
-				return true;
-			}
+			memcpy(reinterpret_cast<uint8_t*>(_instance) + field.Offset, data, field.Size);
+			return;
 		}
 
-		return false;
+		mono_field_set_value(_instance, field.MonoClassField, const_cast<void*>(data));
 	}
 
-	bool ScriptInstance::TrySetFieldStringValueInternal(const std::string& name, const std::string& data) const
+	bool ScriptInstance::TryGetFieldStringValueInternal(const ScriptField& field, std::string& data) const
 	{
-		ScriptField field;
-		if (TryGetField(name, field))
+		if (auto* monoString = reinterpret_cast<MonoString*>(mono_field_get_value_object(mono_object_get_domain(_instance), field.MonoClassField, _instance)))
 		{
-			auto* monoString = mono_string_new(mono_object_get_domain(_instance), data.c_str());
-			mono_field_set_value(_instance, field.MonoClassField, monoString);
+			auto* charData = mono_string_to_utf8(monoString);
+			data = charData;
+			mono_free(charData);
 			return true;
 		}
 
 		return false;
 	}
 
-	bool ScriptInstance::TryGetFieldEntityValueInternal(const std::string& name, Entity& data) const
+	void ScriptInstance::SetFieldStringValueInternal(const ScriptField& field, const std::string& data) const
 	{
-		ScriptField field;
-		if (TryGetField(name, field))
-		{
-			if (auto* monoInstance = mono_field_get_value_object(mono_object_get_domain(_instance), field.MonoClassField, _instance))
-			{
-				const auto& scriptField = ScriptEngine::GetEntityClass()->GetFields().at("Id");
-				uint64_t uuid;
-				mono_field_get_value(monoInstance, scriptField.MonoClassField, &uuid);
-				data = ScriptEngine::GetSceneContext()->GetEntityByUUID(uuid);
-
-				return true;
-			}
-		}
-		return false;
+		auto* monoString = mono_string_new(mono_object_get_domain(_instance), data.c_str());
+		mono_field_set_value(_instance, field.MonoClassField, monoString);
 	}
 
-	bool ScriptInstance::TrySetFieldEntityValueInternal(const std::string& name, const Entity& data) const
+	bool ScriptInstance::TryGetFieldEntityValueInternal(const ScriptField& field, Entity& data) const
 	{
-		ScriptField field;
-		if (TryGetField(name, field))
+		if (auto* monoInstance = mono_field_get_value_object(mono_object_get_domain(_instance), field.MonoClassField, _instance))
 		{
-			// Clear the field.
-			if (!data)
-			{
-				mono_field_set_value(_instance, field.MonoClassField, nullptr);
-				return true;
-			}
-
-			// Assign the field to a entity that has an assigned ScriptInstance
-			if (const auto& entityScriptInstance = ScriptEngine::GetEntityScriptInstance(data.GetUUID()))
-			{
-				mono_field_set_value(_instance, field.MonoClassField, entityScriptInstance->_instance);
-				return true;
-			}
-
-			// Create a ScriptInstance and assign it to the entity.
-			if (const auto& entityScriptInstance = ScriptEngine::OnCreateEntity(data))
-			{
-				mono_field_set_value(_instance, field.MonoClassField, entityScriptInstance->_instance);
-				return true;
-			}
+			const auto& baseClass = ScriptEngine::GetEntityClass();
+			uint64_t uuid;
+			uint32_t handle;
+			mono_field_get_value(monoInstance, baseClass->GetField("Id")->MonoClassField, &uuid);
+			mono_field_get_value(monoInstance, baseClass->GetField("Handle")->MonoClassField, &handle);
+			data = ScriptEngine::GetSceneContext()->GetEntityByHandle(static_cast<entt::entity>(handle), uuid);
+
+			return true;
 		}
 
 		return false;
 	}
 
-	bool ScriptInstance::TryGetField(const std::string& name, ScriptField& scriptField) const
+	bool ScriptInstance::TrySetFieldEntityValueInternal(const ScriptField& field, const Entity& data) const
 	{
-		const auto& fields = _scriptClass->GetFields();
-		auto it = fields.find(name);
-		if (it == fields.end())
+		// Clear the field.
+		if (!data)
 		{
-			return false;
+			mono_field_set_value(_instance, field.MonoClassField, nullptr);
+			return true;
 		}
 
-		scriptField = it->second;
-		return true;
+		// Assign the field to a entity that has an assigned ScriptInstance
+		if (const auto& entityScriptInstance = ScriptEngine::GetEntityScriptInstance(data))
+		{
+			mono_field_set_value(_instance, field.MonoClassField, entityScriptInstance->_instance);
+			return true;
+		}
+
+		// Create a ScriptInstance and assign it to the entity.
+		if (const auto& entityScriptInstance = ScriptEngine::OnCreateEntity(data))
+		{
+			mono_field_set_value(_instance, field.MonoClassField, entityScriptInstance->_instance);
+			return true;
+		}
+
+		return false;
 	}
 }
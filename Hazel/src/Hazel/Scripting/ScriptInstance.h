@@ -1,5 +1,6 @@
 #pragma once
 #include "Hazel/Scene/Entity.h"
+#include "ScriptField.h"
 
 extern "C" // Forward declare of class from C
 {
@@ -10,12 +11,13 @@ extern "C" // Forward declare of class from C
 namespace Hazel
 {
 	class ScriptClass;
-	struct ScriptField;
 
 	class ScriptInstance
 	{
 	public:
 		ScriptInstance(Ref<ScriptClass> scriptClass, Entity entity);
+		ScriptInstance(const ScriptInstance&) = delete;
+		~ScriptInstance();
 
 		void InvokeOnCreate();
 		void InvokeOnDestroy();
@@ -24,80 +26,121 @@ namespace Hazel
 		Ref<ScriptClass> GetScriptClass() const { return _scriptClass; }
 		MonoObject* GetInstance() const { return _instance; }
 
+		// Fields are looked up by name, or passed as resolved by the ScriptClass to skip the lookup.
 		template<typename T>
 		T GetFieldValue(const std::string& name) const
+		{
+			const auto* field = FindField(name);
+			//TODO error handling
+			return field ? GetFieldValue<T>(*field) : T();
+		}
+
+		template<typename T>
+		T GetFieldValue(const ScriptField& field) const
 		{
 			static_assert(sizeof(T) <= 16, "Type too large!");
 
-			if (TryGetFieldValueInternal(name, _sFieldValueBuffer))
+			GetFieldValueInternal(field, _sFieldValueBuffer);
+			return *reinterpret_cast<const T*>(_sFieldValueBuffer);
+		}
+
+		template<typename T>
+		void SetFieldValue(const std::string& name, const T& data)
+		{
+			if (const auto* field = FindField(name))
 			{
-				return *reinterpret_cast<const T*>(_sFieldValueBuffer);
+				SetFieldValue(*field, data);
 			}
 			//TODO error handling
-			return T();
 		}
 
 		template<typename T>
-		void SetFieldValue(const std::string& name, const T& data)
+		void SetFieldValue(const ScriptField& field, const T& data)
 		{
 			static_assert(sizeof(T) <= 16, "Type too large!");
 
-			TrySetFieldValueInternal(name, &data);
-			//TODO error handling
+			SetFieldValueInternal(field, &data);
 		}
 
 		std::string GetFieldStringValue(const std::string& name) const
 		{
-			if (TryGetFieldStringValueInternal(name, _sFieldStringValueBuffer))
+			const auto* field = FindField(name);
+			//TODO error handling
+			return field ? GetFieldStringValue(*field) : std::string();
+		}
+
+		std::string GetFieldStringValue(const ScriptField& field) const
+		{
+			if (TryGetFieldStringValueInternal(field, _sFieldStringValueBuffer))
 			{
 				return _sFieldStringValueBuffer;
 			}
-			//TODO error handling
 			return {};
 		}
 
 		void SetFieldStringValue(const std::string& name, const std::string& data)
 		{
-			TrySetFieldStringValueInternal(name, data);
+			if (const auto* field = FindField(name))
+			{
+				SetFieldStringValueInternal(*field, data);
+			}
 			//TODO error handling
 		}
 
+		void SetFieldStringValue(const ScriptField& field, const std::string& data)
+		{
+			SetFieldStringValueInternal(field, data);
+		}
+
 		Entity GetFieldEntityValue(const std::string& name) const
 		{
-			if (TryGetFieldEntityValueInternal(name, _sFieldEntityValueBuffer))
+			const auto* field = FindField(name);
+			//TODO error handling
+			return field ? GetFieldEntityValue(*field) : Entity();
+		}
+
+		Entity GetFieldEntityValue(const ScriptField& field) const
+		{
+			if (TryGetFieldEntityValueInternal(field, _sFieldEntityValueBuffer))
 			{
 				return _sFieldEntityValueBuffer;
 			}
-			//TODO error handling
 			return Entity();
 		}
 
 		void SetFieldEntityValue(const std::string& name, const Entity& data)
 		{
-			TrySetFieldEntityValueInternal(name, data);
+			if (const auto* field = FindField(name))
+			{
+				TrySetFieldEntityValueInternal(*field, data);
+			}
 			//TODO error handling
 		}
 
+		void SetFieldEntityValue(const ScriptField& field, const Entity& data)
+		{
+			TrySetFieldEntityValueInternal(field, data);
+		}
+
 	private:
-		bool TryGetFieldValueInternal(const std::string& name, void* data) const;
-		bool TrySetFieldValueInternal(const std::string& name, const void* data) const;
+		const ScriptField* FindField(const std::string& name) const;
 
-		bool TryGetFieldStringValueInternal(const std::string& name, std::string& data) const;
-		bool TrySetFieldStringValueInternal(const std::string& name, const std::string& data) const;
+		// Value types are copied straight from and to the pinned object.
+		void GetFieldValueInternal(const ScriptField& field, void* data) const;
+		void SetFieldValueInternal(const ScriptField& field, const void* data) const;
 
-		bool TryGetFieldEntityValueInternal(const std::string& name, Entity& data) const;
-		bool TrySetFieldEntityValueInternal(const std::string& name, const Entity& data) const;
+		bool TryGetFieldStringValueInternal(const ScriptField& field, std::string& data) const;
+		void SetFieldStringValueInternal(const ScriptField& field, const std::string& data) const;
 
-		bool TryGetField(const std::string& name, ScriptField& scriptField) const;
+		bool TryGetFieldEntityValueInternal(const ScriptField& field, Entity& data) const;
+		bool TrySetFieldEntityValueInternal(const ScriptField& field, const Entity& data) const;
 
 	private:
 		Ref<ScriptClass> _scriptClass;
 
 		MonoObject* _instance = nullptr;
 		MonoMethod* _constructor = nullptr;
-		MonoMethod* _onCreateMethod = nullptr;
-		MonoMethod* _onDestroyMethod = nullptr;
-		MonoMethod* _onUpdateMethod = nullptr;
+		uint32_t _gcHandle = 0; // Pinned, _instance never moves nor is collected while referenced here.
 
 		inline static uint8_t _sFieldValueBuffer[16];
 		inline static std::string _sFieldStringValueBuffer;
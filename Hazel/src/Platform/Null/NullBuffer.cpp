@@ -0,0 +1,46 @@
+#include "hzpch.h"
+#include "NullBuffer.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel
+{
+	// -- VertexBuffer --------------------------
+
+	NullVertexBuffer::NullVertexBuffer(uint32_t size)
+		: _rendererID(NullRendererAPI::GenerateRendererID()), _size(size) {}
+
+	NullVertexBuffer::NullVertexBuffer(const float* vertices, uint32_t size)
+		: _rendererID(NullRendererAPI::GenerateRendererID()), _size(size)
+	{
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.VertexBufferUploads++;
+		counters.VertexBufferUploadBytes += size;
+	}
+
+	void NullVertexBuffer::Bind() const
+	{
+		NullRendererAPI::GetCounters().VertexBufferBinds++;
+	}
+
+	void NullVertexBuffer::SetData(const void* data, uint32_t size)
+	{
+		HZ_CORE_ASSERT(size <= _size, "Vertex buffer overflow!");
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.VertexBufferUploads++;
+		counters.VertexBufferUploadBytes += size;
+	}
+
+	// -----------------------------------------
+
+	// -- IndexBuffer --------------------------
+	NullIndexBuffer::NullIndexBuffer(const uint32_t* indices, uint32_t count)
+		: _rendererID(NullRendererAPI::GenerateRendererID()), _count(count) {}
+
+	void NullIndexBuffer::Bind() const
+	{
+		NullRendererAPI::GetCounters().IndexBufferBinds++;
+	}
+	// -----------------------------------------
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Hazel/Renderer/Buffer.h"
+
+namespace Hazel
+{
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer(uint32_t size);
+		NullVertexBuffer(const float* vertices, uint32_t size);
+
+		void Bind() const override;
+		void Unbind() const override {}
+
+		void SetData(const void* data, uint32_t size) override;
+
+		const BufferLayout& GetLayout() override { return _layout; }
+		void SetLayout(const BufferLayout& layout) override { _layout = layout; }
+
+	private:
+		uint32_t _rendererID;
+		uint32_t _size;
+		BufferLayout _layout;
+	};
+
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer(const uint32_t* indices, uint32_t count);
+
+		void Bind() const override;
+		void Unbind() const override {}
+
+		uint32_t GetCount() const override { return _count; }
+
+	private:
+		uint32_t _rendererID;
+		uint32_t _count;
+	};
+}
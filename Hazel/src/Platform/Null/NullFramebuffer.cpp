@@ -0,0 +1,30 @@
+#include "hzpch.h"
+#include "NullFramebuffer.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel
+{
+	NullFramebuffer::NullFramebuffer(const FramebufferSpecification& spec)
+		: _specification(spec)
+	{
+		for (const auto& attachment : _specification.Attachments.Attachments)
+		{
+			if (attachment.TextureFormat != FramebufferTextureFormat::DEPTH24STENCIL8)
+			{
+				_colorAttachments.push_back(NullRendererAPI::GenerateRendererID());
+			}
+		}
+	}
+
+	void NullFramebuffer::Bind()
+	{
+		NullRendererAPI::GetCounters().FramebufferBinds++;
+	}
+
+	void NullFramebuffer::Resize(uint32_t width, uint32_t height)
+	{
+		_specification.Width = width;
+		_specification.Height = height;
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "Hazel/Renderer/Framebuffer.h"
+
+namespace Hazel
+{
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+		NullFramebuffer(const FramebufferSpecification& spec);
+
+		void Bind() override;
+		void Unbind() override {}
+
+		void Resize(uint32_t width, uint32_t height) override;
+		// There is no attachment to read from, always reports no entity.
+		int ReadPixel(uint32_t attachmentIndex, int x, int y) override { return -1; }
+
+		void ClearAttachment(uint32_t attachmentIndex, int value) override {}
+
+		uint32_t GetColorAttachmentRenderID(uint32_t index = 0) const override
+		{
+			HZ_CORE_ASSERT(index < _colorAttachments.size(), "Index out of range");
+			return _colorAttachments[index];
+		}
+		const FramebufferSpecification& GetSpecification() const override { return _specification; }
+
+	private:
+		FramebufferSpecification _specification;
+		std::vector<uint32_t> _colorAttachments;
+	};
+}
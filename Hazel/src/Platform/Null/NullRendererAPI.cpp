@@ -0,0 +1,49 @@
+#include "hzpch.h"
+#include "NullRendererAPI.h"
+
+namespace Hazel
+{
+	NullRendererCounters NullRendererAPI::_sCounters;
+	uint32_t NullRendererAPI::_sNextRendererID = 0;
+
+	NullRendererAPI::NullRendererAPI()
+		: _startTime(std::chrono::steady_clock::now()) {}
+
+	void NullRendererAPI::Init()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_LINFO("Using the Null RendererAPI, nothing will be presented.");
+		ResetCounters();
+	}
+
+	void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseVertex)
+	{
+		vertexArray->Bind();
+		indexCount = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+
+		_sCounters.DrawCalls++;
+		_sCounters.IndexCount += indexCount;
+	}
+
+	void NullRendererAPI::DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex)
+	{
+		vertexArray->Bind();
+
+		_sCounters.DrawCalls++;
+		_sCounters.LineVertexCount += vertexCount;
+	}
+
+	void NullRendererAPI::DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		vertexArray->Bind();
+
+		_sCounters.DrawCalls++;
+		_sCounters.InstanceCount += instanceCount;
+	}
+
+	float NullRendererAPI::GetTime()
+	{
+		return std::chrono::duration<float>(std::chrono::steady_clock::now() - _startTime).count();
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Hazel/Renderer/RendererAPI.h"
+
+#include <chrono>
+
+namespace Hazel
+{
+	// Everything the null backend was asked to do since the last reset.
+	// Used to measure batching efficiency without a GPU.
+	struct NullRendererCounters
+	{
+		uint64_t DrawCalls = 0;
+		uint64_t IndexCount = 0;
+		uint64_t LineVertexCount = 0;
+		uint64_t InstanceCount = 0;
+
+		uint64_t VertexBufferUploads = 0;
+		uint64_t VertexBufferUploadBytes = 0;
+		uint64_t UniformBufferUploads = 0;
+		uint64_t UniformBufferUploadBytes = 0;
+		uint64_t TextureUploads = 0;
+		uint64_t TextureUploadBytes = 0;
+		uint64_t TextureCopies = 0; // GPU side copies, into texture arrays.
+
+		uint64_t VertexArrayBinds = 0;
+		uint64_t VertexBufferBinds = 0;
+		uint64_t IndexBufferBinds = 0;
+		uint64_t TextureBinds = 0;
+		uint64_t ShaderBinds = 0;
+		uint64_t FramebufferBinds = 0;
+	};
+
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+		NullRendererAPI();
+
+		void Init() override;
+
+		void SetDepthMaskReadWrite() override {}
+		void SetDepthMaskReadOnly() override {}
+
+		void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override {}
+
+		void SetClearColor(const Color& color) override {}
+		void Clear() override {}
+		void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+		void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+		void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
+
+		void SetLineWidth(float width) override {}
+
+		float GetTime() override;
+
+		static NullRendererCounters& GetCounters() { return _sCounters; }
+		static void ResetCounters() { _sCounters = NullRendererCounters(); }
+
+		// Renderer IDs are never zero so they behave like real GL names.
+		static uint32_t GenerateRendererID() { return ++_sNextRendererID; }
+
+	private:
+		std::chrono::steady_clock::time_point _startTime;
+
+		static NullRendererCounters _sCounters;
+		static uint32_t _sNextRendererID;
+	};
+}
@@ -0,0 +1,33 @@
+#include "hzpch.h"
+#include "NullShader.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel
+{
+	NullShader::NullShader(const std::string& filePath, bool shouldRecompile)
+	{
+		_shouldRecompile = shouldRecompile;
+
+		auto lastSlash = filePath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = filePath.rfind('.');
+		auto count = lastDot == std::string::npos ? filePath.size() - lastSlash : lastDot - lastSlash;
+		_name = filePath.substr(lastSlash, count);
+
+		// Nothing to compile, the shader is usable right away.
+		_isLoadingCompleted = true;
+	}
+
+	NullShader::NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+		: _name(name)
+	{
+		_shouldRecompile = false;
+		_isLoadingCompleted = true;
+	}
+
+	void NullShader::Bind() const
+	{
+		NullRendererAPI::GetCounters().ShaderBinds++;
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "Hazel/Renderer/Shader.h"
+
+namespace Hazel
+{
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(const std::string& filePath, bool shouldRecompile = false);
+		NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+
+		void Bind() const override;
+		void Unbind() const override {}
+
+		const std::string& GetName() override { return _name; }
+
+		void SetInt(const std::string& name, int value) override {}
+		void SetIntArray(const std::string& name, int* values, uint32_t count) override {}
+		void SetBool(const std::string& name, bool value) override {}
+
+		void SetFloat(const std::string& name, float value) override {}
+		void SetFloat2(const std::string& name, const glm::vec2& value) override {}
+		void SetFloat3(const std::string& name, const glm::vec3& value) override {}
+		void SetFloat4(const std::string& name, const glm::vec4& value) override {}
+
+		void SetMat4(const std::string& name, const glm::mat4& value) override {}
+
+		void CompleteInitialization() override {}
+
+	private:
+		std::string _name;
+	};
+}
@@ -0,0 +1,78 @@
+#include "hzpch.h"
+#include "NullTexture.h"
+
+#include "NullRendererAPI.h"
+
+#include "stb_image.h"
+
+namespace Hazel
+{
+	NullTexture2D::NullTexture2D(const TextureSpecification& specification)
+		: _specification(specification), _rendererID(NullRendererAPI::GenerateRendererID()) {}
+
+	NullTexture2D::NullTexture2D(const std::filesystem::path& path)
+		: _path(path), _rendererID(NullRendererAPI::GenerateRendererID())
+	{
+		HZ_PROFILE_FUNCTION();
+
+		// Only the header is read, there is nothing to upload the pixels to.
+		int width = 0, height = 0, channels = 4;
+		if (stbi_info(_path.string().c_str(), &width, &height, &channels))
+		{
+			_specification.Width = width;
+			_specification.Height = height;
+			_specification.Format = channels == 3 ? ImageFormat::RGB8 : ImageFormat::RGBA8;
+		}
+		else
+		{
+			HZ_CORE_LWARN("Failed to read image header {0}", _path);
+		}
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.TextureUploads++;
+		counters.TextureUploadBytes += static_cast<uint64_t>(_specification.Width) * _specification.Height * (channels == 3 ? 3 : 4);
+	}
+
+	NullTexture2D::NullTexture2D(const TextureImage& image)
+		: NullTexture2D(image.Specification)
+	{
+		_path = image.Path;
+		SetData(const_cast<uint8_t*>(image.Pixels.data()), static_cast<uint32_t>(image.Pixels.size()));
+
+		auto& counters = NullRendererAPI::GetCounters();
+		for (const auto& mip : image.Mips)
+		{
+			counters.TextureUploads++;
+			counters.TextureUploadBytes += mip.size();
+		}
+	}
+
+	void NullTexture2D::SetData(void* data, uint32_t size)
+	{
+		_specification.HasTranslucency = HasTranslucentTexels(data, size, _specification.Format);
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.TextureUploads++;
+		counters.TextureUploadBytes += size;
+	}
+
+	void NullTexture2D::Bind(uint32_t slot) const
+	{
+		NullRendererAPI::GetCounters().TextureBinds++;
+	}
+
+	NullTexture2DArray::NullTexture2DArray(const TextureSpecification& specification, uint32_t layerCount, uint32_t magFilter)
+		: _specification(specification), _layerCount(layerCount), _rendererID(NullRendererAPI::GenerateRendererID()), _magFilter(magFilter) {}
+
+	void NullTexture2DArray::CopyToLayer(uint32_t layer, const Texture2D& texture)
+	{
+		HZ_CORE_ASSERT(layer < _layerCount, "Layer out of range");
+
+		NullRendererAPI::GetCounters().TextureCopies++;
+	}
+
+	void NullTexture2DArray::Bind(uint32_t slot) const
+	{
+		NullRendererAPI::GetCounters().TextureBinds++;
+	}
+}
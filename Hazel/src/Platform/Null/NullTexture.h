@@ -0,0 +1,70 @@
+#pragma once
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel
+{
+	class NullTexture2D : public Texture2D
+	{
+	public:
+		// Same values as GL_NEAREST and GL_LINEAR so editor code can pass filters through unchanged.
+		static constexpr uint32_t kFilterNearest = 0x2600;
+		static constexpr uint32_t kFilterLinear = 0x2601;
+
+	public:
+		NullTexture2D(const TextureSpecification& specification);
+		NullTexture2D(const std::filesystem::path& path);
+		NullTexture2D(const TextureImage& image);
+
+		const TextureSpecification& GetSpecification() const override { return _specification; }
+
+		uint32_t GetWidth() const override { return _specification.Width; }
+		uint32_t GetHeight() const override { return _specification.Height; }
+		uint32_t GetRendererID() const override { return _rendererID; }
+		void* GetRawID() const override { return reinterpret_cast<void*>(static_cast<intptr_t>(_rendererID)); }
+		const std::filesystem::path& GetPath() const override { return _path; }
+		uint32_t GetMagFilter() const override { return _magFilter; }
+		uint32_t GetMipLevelCount() const override { return _specification.GenerateMips ? CalculateMipLevelCount(_specification.Width, _specification.Height) : 1; }
+		uint64_t GetMemorySize() const override { return CalculateMemorySize(_specification, GetMipLevelCount()); }
+		bool IsMagFilterLinear() const override { return _magFilter == kFilterLinear; }
+
+		void SetData(void* data, uint32_t size) override;
+		void SetMagFilter(uint32_t magFilter) override { _magFilter = magFilter; }
+		void ToggleMagFilter(uint32_t magFilter) override { _magFilter = magFilter == kFilterLinear ? kFilterNearest : kFilterLinear; }
+
+		void Bind(uint32_t slot = 0) const override;
+		bool Equals(const Texture& other) const override { return _rendererID == other.GetRendererID(); }
+
+		bool operator ==(const Texture& other) const override { return Equals(other); }
+
+	private:
+		TextureSpecification _specification;
+
+		std::filesystem::path _path;
+		uint32_t _rendererID;
+		uint32_t _magFilter = kFilterLinear;
+	};
+
+	class NullTexture2DArray : public Texture2DArray
+	{
+	public:
+		NullTexture2DArray(const TextureSpecification& specification, uint32_t layerCount, uint32_t magFilter);
+
+		const TextureSpecification& GetSpecification() const override { return _specification; }
+
+		uint32_t GetLayerCount() const override { return _layerCount; }
+		uint32_t GetRendererID() const override { return _rendererID; }
+		uint32_t GetMagFilter() const override { return _magFilter; }
+		uint32_t GetMipLevelCount() const override { return _specification.GenerateMips ? Texture::CalculateMipLevelCount(_specification.Width, _specification.Height) : 1; }
+
+		void CopyToLayer(uint32_t layer, const Texture2D& texture) override;
+
+		void Bind(uint32_t slot = 0) const override;
+
+	private:
+		TextureSpecification _specification;
+
+		uint32_t _layerCount;
+		uint32_t _rendererID;
+		uint32_t _magFilter;
+	};
+}
@@ -0,0 +1,19 @@
+#include "hzpch.h"
+#include "NullUniformBuffer.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel
+{
+	NullUniformBuffer::NullUniformBuffer(uint32_t size, uint32_t binding)
+		: _size(size) {}
+
+	void NullUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_CORE_ASSERT(offset + size <= _size, "Uniform buffer overflow!");
+
+		auto& counters = NullRendererAPI::GetCounters();
+		counters.UniformBufferUploads++;
+		counters.UniformBufferUploadBytes += size;
+	}
+}
@@ -0,0 +1,27 @@
+#include "hzpch.h"
+#include "NullVertexArray.h"
+
+#include "NullRendererAPI.h"
+
+namespace Hazel
+{
+	NullVertexArray::NullVertexArray()
+		: _rendererID(NullRendererAPI::GenerateRendererID()) {}
+
+	void NullVertexArray::Bind() const
+	{
+		NullRendererAPI::GetCounters().VertexArrayBinds++;
+	}
+
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		HZ_CORE_ASSERT(!vertexBuffer->GetLayout().GetElement().empty(), "Vertex Buffer has no layout!");
+
+		_vertexBuffers.push_back(vertexBuffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+	{
+		_indexBuffer = indexBuffer;
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Hazel/Renderer/VertexArray.h"
+
+namespace Hazel
+{
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		NullVertexArray();
+
+		void Bind() const override;
+		void Unbind() const override {}
+
+		void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+		void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+		const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return _vertexBuffers; }
+		const Ref<IndexBuffer>& GetIndexBuffer() const override { return _indexBuffer; }
+
+	private:
+		uint32_t _rendererID;
+		std::vector<Ref<VertexBuffer>> _vertexBuffers;
+		Ref<IndexBuffer> _indexBuffer;
+	};
+}
@@ -0,0 +1,15 @@
+#include "hzpch.h"
+#include "NullWindow.h"
+
+namespace Hazel
+{
+	NullWindow::NullWindow(const WindowProps& props)
+	{
+		_data.Title = props.Title;
+		_data.Width = props.Width;
+		_data.Height = props.Height;
+		_data.VSync = props.VSync;
+
+		HZ_CORE_LINFO("Creating headless window : {0}, ({1} x {2})", props.Title, props.Width, props.Height);
+	}
+}
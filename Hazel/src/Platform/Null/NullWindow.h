@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Hazel/Core/Window.h"
+
+namespace Hazel
+{
+	// Window of headless builds, no GLFW nor graphics context so nothing needs a display or a GPU driver.
+	class NullWindow final : public Window
+	{
+	public:
+		NullWindow(const WindowProps& props);
+
+		virtual void OnUpdate() override {}
+		virtual void ProcessEvents() override {}
+
+		virtual uint32_t GetWidth() const override { return _data.Width; }
+		virtual uint32_t GetHeight() const override { return _data.Height; }
+		virtual std::string GetTitle() const override { return _data.Title; }
+
+		virtual void SetEventCallback(const EventCallbackFn& callback) override { _data.EventCallback = callback; }
+		virtual void SetVSync(bool enable) override { _data.VSync = enable; }
+		virtual bool IsVSync() const override { return _data.VSync; }
+		virtual void SetTitle(const std::string& title) override { _data.Title = title; }
+
+		virtual void* GetNativeWindow() const override { return nullptr; }
+
+	private:
+		struct WindowData
+		{
+			std::string Title;
+			uint32_t Width;
+			uint32_t Height;
+			bool VSync;
+
+			EventCallbackFn EventCallback;
+		};
+
+		WindowData _data;
+	};
+}
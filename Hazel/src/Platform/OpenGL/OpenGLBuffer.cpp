@@ -25,10 +25,60 @@ namespace Hazel
 		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
 	}
 
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t batchSize, uint32_t batchesPerFrame, uint32_t frameCount)
+		: _batchSize(batchSize), _frameSize(batchSize * batchesPerFrame)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(batchesPerFrame > 0 && frameCount > 0, "Streaming vertex buffer needs at least one batch per frame!");
+
+		glGenBuffers(1, &_rendererID);
+		glBindBuffer(GL_ARRAY_BUFFER, _rendererID);
+
+		if (!GLAD_GL_VERSION_4_4 || !glBufferStorage)
+		{
+			HZ_CORE_LWARN("glBufferStorage is not available, vertex streaming falls back to glBufferSubData.");
+			glBufferData(GL_ARRAY_BUFFER, batchSize, nullptr, GL_DYNAMIC_DRAW);
+			return;
+		}
+
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(_frameSize) * frameCount;
+		glBufferStorage(GL_ARRAY_BUFFER, bufferSize, nullptr, flags);
+		_mappedData = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferSize, flags));
+
+		if (_mappedData == nullptr)
+		{
+			// Immutable storage cannot be respecified, start over with a mutable buffer.
+			HZ_CORE_LWARN("Failed to map streaming vertex buffer, falling back to glBufferSubData.");
+			glDeleteBuffers(1, &_rendererID);
+			glGenBuffers(1, &_rendererID);
+			glBindBuffer(GL_ARRAY_BUFFER, _rendererID);
+			glBufferData(GL_ARRAY_BUFFER, batchSize, nullptr, GL_DYNAMIC_DRAW);
+			return;
+		}
+
+		_frameFences.resize(frameCount, nullptr);
+	}
+
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
 		HZ_PROFILE_FUNCTION();
 
+		for (GLsync fence : _frameFences)
+		{
+			if (fence)
+			{
+				glDeleteSync(fence);
+			}
+		}
+
+		if (_mappedData)
+		{
+			glBindBuffer(GL_ARRAY_BUFFER, _rendererID);
+			glUnmapBuffer(GL_ARRAY_BUFFER);
+		}
+
 		glDeleteBuffers(1, &_rendererID);
 	}
 
@@ -48,10 +98,82 @@ namespace Hazel
 
 	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size)
 	{
+		if (_mappedData)
+		{
+			HZ_CORE_ASSERT(size <= _batchSize, "Vertex buffer overflow!");
+
+			void* region = GetMappedRegion();
+			if (region != data)
+			{
+				memcpy(region, data, size);
+			}
+			return;
+		}
+
 		glBindBuffer(GL_ARRAY_BUFFER, _rendererID);
 		glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
 	}
 
+	void OpenGLVertexBuffer::AdvanceRegion(uint32_t size)
+	{
+		if (_mappedData == nullptr)
+		{
+			return;
+		}
+
+		HZ_CORE_ASSERT(size <= _batchSize, "Vertex buffer overflow!");
+		_frameOffset += size;
+
+		// Out of room for a full batch, the next frame starts early and may have to wait on the GPU.
+		if (_frameOffset + _batchSize > _frameSize)
+		{
+			EndFrame();
+		}
+	}
+
+	void OpenGLVertexBuffer::EndFrame()
+	{
+		if (_mappedData == nullptr || _frameOffset == 0)
+		{
+			return;
+		}
+
+		_frameFences[_frameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		_frameIndex = (_frameIndex + 1) % static_cast<uint32_t>(_frameFences.size());
+		_frameOffset = 0;
+
+		WaitForFrame(_frameIndex);
+	}
+
+	void OpenGLVertexBuffer::WaitForFrame(uint32_t frameIndex)
+	{
+		GLsync& fence = _frameFences[frameIndex];
+		if (fence == nullptr)
+		{
+			return;
+		}
+
+		HZ_PROFILE_FUNCTION();
+
+		// Only flush on the retry, the fence usually signaled long ago.
+		GLbitfield waitFlags = 0;
+		GLuint64 timeout = 0;
+		while (true)
+		{
+			const GLenum result = glClientWaitSync(fence, waitFlags, timeout);
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+			{
+				break;
+			}
+
+			waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+			timeout = 1'000'000; // 1 ms
+		}
+
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
 	// -----------------------------------------
 
 	// -- IndexBuffer --------------------------
@@ -1,6 +1,8 @@
 #pragma once
 #include "Hazel/Renderer/Buffer.h"
 
+typedef struct __GLsync* GLsync;
+
 namespace Hazel
 {
 	class OpenGLVertexBuffer : public VertexBuffer
@@ -8,6 +10,8 @@ namespace Hazel
 	public:
 		OpenGLVertexBuffer(uint32_t size);
 		OpenGLVertexBuffer(const float* vertices, uint32_t size);
+		// Streaming buffer, see VertexBuffer::CreateStreaming.
+		OpenGLVertexBuffer(uint32_t batchSize, uint32_t batchesPerFrame, uint32_t frameCount);
 		virtual ~OpenGLVertexBuffer() override;
 
 		void Bind() const override;
@@ -18,9 +22,25 @@ namespace Hazel
 		const BufferLayout& GetLayout() override { return _layout; }
 		void SetLayout(const BufferLayout& layout) override { _layout = layout; }
 
+		bool IsStreaming() const override { return _mappedData != nullptr; }
+		void* GetMappedRegion() override { return _mappedData ? _mappedData + GetMappedRegionOffset() : nullptr; }
+		uint32_t GetMappedRegionOffset() const override { return _frameIndex * _frameSize + _frameOffset; }
+		void AdvanceRegion(uint32_t size) override;
+		void EndFrame() override;
+
+	private:
+		void WaitForFrame(uint32_t frameIndex);
+
 	private:
 		uint32_t _rendererID;
 		BufferLayout _layout;
+
+		uint8_t* _mappedData = nullptr;
+		uint32_t _batchSize = 0;
+		uint32_t _frameSize = 0;
+		uint32_t _frameIndex = 0;
+		uint32_t _frameOffset = 0; // Bytes already written this frame.
+		std::vector<GLsync> _frameFences;
 	};
 
 	class OpenGLIndexBuffer : public IndexBuffer
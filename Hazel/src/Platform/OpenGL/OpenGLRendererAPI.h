@@ -16,8 +16,9 @@ namespace Hazel
 
 		void SetClearColor(const Color& color) override;
 		void Clear() override;
-		void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
-		void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount) override;
+		void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+		void DrawLines(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+		void DrawInstanced(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
 
 		void SetLineWidth(float width) override;
 
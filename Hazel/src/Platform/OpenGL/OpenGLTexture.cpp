@@ -1,8 +1,6 @@
 #include "hzpch.h"
 #include "OpenGLTexture.h"
 
-#include "stb_image.h"
-
 namespace Hazel
 {
 	namespace Utils
@@ -39,11 +37,13 @@ namespace Hazel
 
 		_internalFormat = Utils::HazelImageFormatToGLInternalFormat(_specification.Format);
 		_dataFormat = Utils::HazelImageFormatToGLDataFormat(_specification.Format);
+		_mipLevelCount = _specification.GenerateMips ? CalculateMipLevelCount(_width, _height) : 1;
 
 		glCreateTextures(GL_TEXTURE_2D, 1, &_rendererID);
-		glTextureStorage2D(_rendererID, 1, _internalFormat, _width, _height);
+		glTextureStorage2D(_rendererID, _mipLevelCount, _internalFormat, _width, _height);
 
-		glTextureParameteri(_rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		// Trilinear when there are mips, minified sprites read the smaller levels instead of skipping texels.
+		glTextureParameteri(_rendererID, GL_TEXTURE_MIN_FILTER, _mipLevelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
 		_magFilter = GL_LINEAR;
 		glTextureParameteri(_rendererID, GL_TEXTURE_MAG_FILTER, _magFilter);
 
@@ -53,70 +53,26 @@ namespace Hazel
 	}
 
 	OpenGLTexture2D::OpenGLTexture2D(const std::filesystem::path& path)
-		: _path(path)
+		: OpenGLTexture2D(Texture2D::Decode(path)) {}
+
+	// The levels generated on the CPU are uploaded as they are.
+	OpenGLTexture2D::OpenGLTexture2D(const TextureImage& image)
+		: OpenGLTexture2D(image.Specification)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		HZ_CORE_ASSERT(std::filesystem::exists(path), fmt::format("File path {0} not found!", path.string()));
-
-		int width, height, channels;
-		stbi_set_flip_vertically_on_load(1);
-
-		stbi_uc* data = nullptr;
-		{
-			HZ_PROFILE_SCOPE("stbi_load");
-			data = stbi_load(_path.string().c_str(), &width, &height, &channels, 0);
-		}
-
-		const bool hasLoadingFailed = !data;
-		if (hasLoadingFailed)
-		{
-			stbi_image_free(data);
-			HZ_CORE_ASSERT(false, "Failed to load image!");
-			uint8_t dataError[4] = {255, 128, 255, 255};
-			data = dataError;
-			width = 1;
-			height = 1;
-			channels = 4;
-		}
-
-		_width = width;
-		_height = height;
+		_path = image.Path;
 
-		GLenum internalFormat = 0;
-		GLenum dataFormat = 0;
-		if (channels == 4)
-		{
-			internalFormat = GL_RGBA8;
-			dataFormat = GL_RGBA;
-		}
-		else if (channels == 3)
+		if (image.Mips.size() + 1 < _mipLevelCount)
 		{
-			internalFormat = GL_RGB8;
-			dataFormat = GL_RGB;
+			SetData(const_cast<uint8_t*>(image.Pixels.data()), static_cast<uint32_t>(image.Pixels.size()));
+			return;
 		}
 
-		HZ_CORE_ASSERT(internalFormat & dataFormat, "Format not supported!");
-
-		_internalFormat = internalFormat;
-		_dataFormat = dataFormat;
-
-		glCreateTextures(GL_TEXTURE_2D, 1, &_rendererID);
-		glTextureStorage2D(_rendererID, 1, _internalFormat, _width, _height);
-
-		glTextureParameteri(_rendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		_magFilter = GL_LINEAR;
-		glTextureParameteri(_rendererID, GL_TEXTURE_MAG_FILTER, _magFilter);
-
-		// Tiling.
-		glTextureParameteri(_rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTextureParameteri(_rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-		glTextureSubImage2D(_rendererID, 0, 0, 0, _width, _height, _dataFormat, GL_UNSIGNED_BYTE, data);
-
-		if (!hasLoadingFailed)
+		UploadLevel(0, image.Pixels.data());
+		for (uint32_t level = 1; level < _mipLevelCount; level++)
 		{
-			stbi_image_free(data);
+			UploadLevel(level, image.Mips[level - 1].data());
 		}
 	}
 
@@ -133,7 +89,25 @@ namespace Hazel
 
 		uint32_t bytesPerPixel = _dataFormat == GL_RGBA ? 4 : 3;
 		HZ_ASSERT(size == _width * _height * bytesPerPixel, "Data must be entire texture!");
-		glTextureSubImage2D(_rendererID, 0, 0, 0, _width, _height, _dataFormat, GL_UNSIGNED_BYTE, data);
+		UploadLevel(0, data);
+		_specification.HasTranslucency = HasTranslucentTexels(data, size, _specification.Format);
+
+		// Data written at runtime has no CPU mips, the driver filters them.
+		if (_mipLevelCount > 1)
+		{
+			glGenerateTextureMipmap(_rendererID);
+		}
+	}
+
+	void OpenGLTexture2D::UploadLevel(uint32_t level, const void* data)
+	{
+		const uint32_t width = std::max(1u, _width >> level);
+		const uint32_t height = std::max(1u, _height >> level);
+
+		// RGB rows of odd sizes are not 4 bytes aligned.
+		glPixelStorei(GL_UNPACK_ALIGNMENT, _dataFormat == GL_RGBA ? 4 : 1);
+		glTextureSubImage2D(_rendererID, level, 0, 0, width, height, _dataFormat, GL_UNSIGNED_BYTE, data);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
@@ -159,4 +133,57 @@ namespace Hazel
 		_magFilter = magFilter == GL_LINEAR ? GL_NEAREST : GL_LINEAR;
 		glTextureParameteri(_rendererID, GL_TEXTURE_MAG_FILTER, _magFilter);
 	}
+
+	OpenGLTexture2DArray::OpenGLTexture2DArray(const TextureSpecification& specification, uint32_t layerCount, uint32_t magFilter)
+		: _specification(specification), _layerCount(layerCount), _magFilter(magFilter)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const GLenum internalFormat = Utils::HazelImageFormatToGLInternalFormat(_specification.Format);
+		_mipLevelCount = _specification.GenerateMips ? Texture::CalculateMipLevelCount(_specification.Width, _specification.Height) : 1;
+
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &_rendererID);
+		glTextureStorage3D(_rendererID, _mipLevelCount, internalFormat, _specification.Width, _specification.Height, _layerCount);
+
+		glTextureParameteri(_rendererID, GL_TEXTURE_MIN_FILTER, _mipLevelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTextureParameteri(_rendererID, GL_TEXTURE_MAG_FILTER, _magFilter);
+
+		// Tiling.
+		glTextureParameteri(_rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(_rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+
+	OpenGLTexture2DArray::~OpenGLTexture2DArray()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		glDeleteTextures(1, &_rendererID);
+	}
+
+	void OpenGLTexture2DArray::CopyToLayer(uint32_t layer, const Texture2D& texture)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(layer < _layerCount, "Layer out of range");
+		HZ_CORE_ASSERT(texture.GetWidth() == _specification.Width && texture.GetHeight() == _specification.Height, "Texture size must match the array!");
+		HZ_CORE_ASSERT(texture.GetSpecification().Format == _specification.Format, "Texture format must match the array!");
+
+		HZ_CORE_ASSERT(texture.GetMipLevelCount() == _mipLevelCount, "Texture levels must match the array!");
+
+		for (uint32_t level = 0; level < _mipLevelCount; level++)
+		{
+			const uint32_t width = std::max(1u, _specification.Width >> level);
+			const uint32_t height = std::max(1u, _specification.Height >> level);
+			glCopyImageSubData(texture.GetRendererID(), GL_TEXTURE_2D, level, 0, 0, 0,
+				_rendererID, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+				width, height, 1);
+		}
+	}
+
+	void OpenGLTexture2DArray::Bind(uint32_t slot) const
+	{
+		HZ_PROFILE_FUNCTION();
+
+		glBindTextureUnit(slot, _rendererID);
+	}
 }
@@ -10,6 +10,7 @@ namespace Hazel
 	public:
 		OpenGLTexture2D(const TextureSpecification& specification);
 		OpenGLTexture2D(const std::filesystem::path& path);
+		OpenGLTexture2D(const TextureImage& image);
 		virtual ~OpenGLTexture2D() override;
 
 		const TextureSpecification& GetSpecification() const override { return _specification; }
@@ -20,6 +21,8 @@ namespace Hazel
 		void* GetRawID() const override { return reinterpret_cast<void*>(static_cast<intptr_t>(_rendererID)); }
 		const std::filesystem::path& GetPath() const override { return _path; }
 		uint32_t GetMagFilter() const override { return _magFilter; }
+		uint32_t GetMipLevelCount() const override { return _mipLevelCount; }
+		uint64_t GetMemorySize() const override { return CalculateMemorySize(_specification, _mipLevelCount); }
 		bool IsMagFilterLinear() const override { return _magFilter == GL_LINEAR; }
 
 		void SetData(void* data, uint32_t size) override;
@@ -34,6 +37,9 @@ namespace Hazel
 			return _rendererID == dynamic_cast<const OpenGLTexture2D&>(other)._rendererID;
 		}
 
+	private:
+		void UploadLevel(uint32_t level, const void* data);
+
 	private:
 		TextureSpecification _specification;
 
@@ -44,5 +50,32 @@ namespace Hazel
 		GLenum _internalFormat;
 		GLenum _dataFormat;
 		uint32_t _magFilter;
+		uint32_t _mipLevelCount;
+	};
+
+	class OpenGLTexture2DArray : public Texture2DArray
+	{
+	public:
+		OpenGLTexture2DArray(const TextureSpecification& specification, uint32_t layerCount, uint32_t magFilter);
+		virtual ~OpenGLTexture2DArray() override;
+
+		const TextureSpecification& GetSpecification() const override { return _specification; }
+
+		uint32_t GetLayerCount() const override { return _layerCount; }
+		uint32_t GetRendererID() const override { return _rendererID; }
+		uint32_t GetMagFilter() const override { return _magFilter; }
+		uint32_t GetMipLevelCount() const override { return _mipLevelCount; }
+
+		void CopyToLayer(uint32_t layer, const Texture2D& texture) override;
+
+		void Bind(uint32_t slot = 0) const override;
+
+	private:
+		TextureSpecification _specification;
+
+		uint32_t _layerCount;
+		uint32_t _rendererID;
+		uint32_t _magFilter;
+		uint32_t _mipLevelCount;
 	};
 }
@@ -85,6 +85,7 @@ namespace Hazel
 					layout.GetStride(),
 					(const void*)(size_t)element.Offset
 				);
+				glVertexAttribDivisor(_vertexBufferIndex, layout.IsPerInstance() ? 1 : 0);
 				_vertexBufferIndex++;
 			}
 			break;
@@ -103,6 +104,7 @@ namespace Hazel
 					layout.GetStride(),
 					(const void*)(size_t)element.Offset
 				);
+				glVertexAttribDivisor(_vertexBufferIndex, layout.IsPerInstance() ? 1 : 0);
 				_vertexBufferIndex++;
 			}
 			break;
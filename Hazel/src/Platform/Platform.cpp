@@ -4,6 +4,7 @@
 #include "Hazel/Renderer/RenderCommand.h"
 #include "Hazel/Renderer/Renderer.h"
 #include "OpenGL/OpenGLRendererAPI.h"
+#include "Null/NullRendererAPI.h"
 
 namespace Hazel
 {
@@ -11,7 +12,12 @@ namespace Hazel
 
 	//--- Initialize the current platform. ---//
 	// Currently using OpenGL since its only one supported.
+	// Headless builds use the Null API so the renderer can run without a GPU.
+#ifdef HZ_HEADLESS
+	RendererAPI::API RendererAPI::_sAPI = API::None;
+#else
 	RendererAPI::API RendererAPI::_sAPI = API::OpenGL;
+#endif // HZ_HEADLESS
 	auto renderAPI = CreateRendererAPI();
 	Ref<RendererAPI> RenderCommand::_sRendererAPI = renderAPI;
 	Scope<Platform> Platform::_sInstance = CreateScope<Platform>(renderAPI);
@@ -22,8 +28,7 @@ namespace Hazel
 		switch (Renderer::GetAPI())
 		{
 		case RendererAPI::API::None:
-			HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported.");
-			return nullptr;
+			return CreateRef<NullRendererAPI>();
 		case RendererAPI::API::OpenGL:
 			return CreateRef<OpenGLRendererAPI>();
 		case RendererAPI::API::DirectX:
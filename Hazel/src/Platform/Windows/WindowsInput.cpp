@@ -17,6 +17,11 @@ namespace Hazel
 		HZ_PROFILE_FUNCTION();
 
 		auto* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+		if (!window)
+		{
+			return {0.0f, 0.0f};
+		}
+
 		double xPos, yPos;
 		glfwGetCursorPos(window, &xPos, &yPos);
 
@@ -0,0 +1,60 @@
+#include "hzpch.h"
+#include "Hazel/Core/MappedFile.h"
+
+namespace Hazel
+{
+	MappedFile::MappedFile(const std::filesystem::path& filePath)
+	{
+		HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			HZ_CORE_LERROR("Fail to open filePath {0}!", filePath);
+			return;
+		}
+
+		_fileHandle = file;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			HZ_CORE_LERROR("File empty!");
+			return;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr)
+		{
+			HZ_CORE_LERROR("Fail to map filePath {0}!", filePath);
+			return;
+		}
+
+		_mappingHandle = mapping;
+
+		_data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (_data == nullptr)
+		{
+			HZ_CORE_LERROR("Fail to map filePath {0}!", filePath);
+			return;
+		}
+
+		_size = static_cast<uint64_t>(size.QuadPart);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		if (_data)
+		{
+			UnmapViewOfFile(_data);
+		}
+
+		if (_mappingHandle)
+		{
+			CloseHandle(_mappingHandle);
+		}
+
+		if (_fileHandle)
+		{
+			CloseHandle(_fileHandle);
+		}
+	}
+}
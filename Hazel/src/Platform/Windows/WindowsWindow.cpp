@@ -7,6 +7,7 @@
 #include "Hazel/Events/KeyEvent.h"
 
 #include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/Null/NullWindow.h"
 
 namespace Hazel
 {
@@ -22,7 +23,11 @@ namespace Hazel
 	{
 		HZ_PROFILE_FUNCTION();
 
+#ifdef HZ_HEADLESS
+		return new NullWindow(props);
+#else
 		return new WindowsWindow(props);
+#endif // HZ_HEADLESS
 	}
 
 	WindowsWindow::WindowsWindow(const WindowProps& props)
@@ -0,0 +1,79 @@
+#type vertex
+#version 450 core
+
+// One instance per circle, the corners of the unit quad come from gl_VertexIndex (triangle strip).
+layout(location = 0) in vec3 a_AxisX;
+layout(location = 1) in vec3 a_AxisY;
+layout(location = 2) in vec3 a_Center;
+layout(location = 3) in int a_Color; // RGBA8
+layout(location = 4) in float a_Thickness;
+layout(location = 5) in float a_Fade;
+layout(location = 6) in int a_EntityID;
+
+layout(std140, binding = 0) uniform Camera
+{
+	mat4 u_ViewProjection;
+};
+
+struct VertexOutput
+{
+	vec3 LocalPosition;
+	vec4 Color;
+	float Thickness;
+	float Fade;
+};
+
+layout (location = 0) out VertexOutput Output;
+layout (location = 4) out flat int v_EntityID;
+
+void main()
+{
+	vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+
+	Output.LocalPosition = vec3(corner * 2.0 - 1.0, 0.0);
+	Output.Color = unpackUnorm4x8(uint(a_Color));
+	Output.Thickness = a_Thickness;
+	Output.Fade = a_Fade;
+	v_EntityID = a_EntityID;
+
+	vec3 position = a_Center + a_AxisX * (corner.x - 0.5) + a_AxisY * (corner.y - 0.5);
+	gl_Position = u_ViewProjection * vec4(position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+layout(location = 1) out int o_EntityID; // -1 is not an entity
+
+struct VertexOutput
+{
+	vec3 LocalPosition;
+	vec4 Color;
+	float Thickness;
+	float Fade;
+};
+
+layout (location = 0) in VertexOutput Input;
+layout (location = 4) in flat int v_EntityID;
+
+void main()
+{
+	vec4 tempColor = Input.Color;
+
+	float distance = 1.0 - length(Input.LocalPosition);
+	float circle = smoothstep(0.0, Input.Fade, distance);
+
+	circle *= smoothstep(Input.Thickness + Input.Fade, Input.Thickness, distance);
+
+	if (circle == 0 || tempColor.a < 0.01)
+	{
+		discard;
+	}
+
+	// Final assignment
+	o_Color = tempColor;
+	o_Color.a *= circle;
+
+	o_EntityID = v_EntityID;
+}
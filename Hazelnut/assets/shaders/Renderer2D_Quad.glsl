@@ -52,12 +52,23 @@ layout (location = 0) in VertexOutput Input;
 layout (location = 4) in flat int v_EntityID;
 layout (location = 5) in flat int v_TextureIndex;
 
-layout (binding = 0) uniform sampler2D u_Texture[32];
+// The last 4 texture slots hold texture arrays, see Renderer2DData::kTextureArraySlots.
+layout (binding = 0) uniform sampler2D u_Texture[28];
+layout (binding = 28) uniform sampler2DArray u_TextureArray[4];
+
+// Indices from here on are (array slot << 12) | layer.
+const int kTextureArrayIndexFlag = 1 << 16;
 
 void main()
 {
 	vec4 tempColor = Input.Color;
-	if (v_TextureIndex >= 0 && v_TextureIndex < 32)
+	if (v_TextureIndex >= kTextureArrayIndexFlag)
+	{
+		int arraySlot = (v_TextureIndex >> 12) & 0xF;
+		int layer = v_TextureIndex & 0xFFF;
+		tempColor *= texture(u_TextureArray[arraySlot], vec3(Input.TextureCoord * Input.TilingFactor, layer));
+	}
+	else if (v_TextureIndex >= 0 && v_TextureIndex < 28)
 	{
 		tempColor *= texture(u_Texture[v_TextureIndex], Input.TextureCoord * Input.TilingFactor);
 	}
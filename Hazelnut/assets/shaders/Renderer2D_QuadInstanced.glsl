@@ -0,0 +1,86 @@
+#type vertex
+#version 450 core
+
+// One instance per quad, the corners of the unit quad come from gl_VertexIndex (triangle strip).
+layout(location = 0) in vec3 a_AxisX;
+layout(location = 1) in vec3 a_AxisY;
+layout(location = 2) in vec3 a_Center;
+layout(location = 3) in int a_Color; // RGBA8
+layout(location = 4) in vec4 a_UVRect; // min.xy, max.xy, already scaled by the tiling factor.
+layout(location = 5) in int a_TextureIndex;
+layout(location = 6) in int a_EntityID;
+
+layout(std140, binding = 0) uniform Camera
+{
+	mat4 u_ViewProjection;
+};
+
+struct VertexOutput
+{
+	vec4 Color;
+	vec2 TextureCoord;
+};
+
+layout (location = 0) out VertexOutput Output;
+layout (location = 4) out flat int v_EntityID;
+layout (location = 5) out flat int v_TextureIndex;
+
+void main()
+{
+	vec2 corner = vec2(gl_VertexIndex & 1, gl_VertexIndex >> 1);
+
+	Output.Color = unpackUnorm4x8(uint(a_Color));
+	Output.TextureCoord = mix(a_UVRect.xy, a_UVRect.zw, corner);
+	v_TextureIndex = a_TextureIndex;
+	v_EntityID = a_EntityID;
+
+	vec3 position = a_Center + a_AxisX * (corner.x - 0.5) + a_AxisY * (corner.y - 0.5);
+	gl_Position = u_ViewProjection * vec4(position, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 o_Color;
+layout(location = 1) out int o_EntityID; // -1 is not an entity
+
+struct VertexOutput
+{
+	vec4 Color;
+	vec2 TextureCoord;
+};
+
+layout (location = 0) in VertexOutput Input;
+layout (location = 4) in flat int v_EntityID;
+layout (location = 5) in flat int v_TextureIndex;
+
+// The last 4 texture slots hold texture arrays, see Renderer2DData::kTextureArraySlots.
+layout (binding = 0) uniform sampler2D u_Texture[28];
+layout (binding = 28) uniform sampler2DArray u_TextureArray[4];
+
+// Indices from here on are (array slot << 12) | layer.
+const int kTextureArrayIndexFlag = 1 << 16;
+
+void main()
+{
+	vec4 tempColor = Input.Color;
+	if (v_TextureIndex >= kTextureArrayIndexFlag)
+	{
+		int arraySlot = (v_TextureIndex >> 12) & 0xF;
+		int layer = v_TextureIndex & 0xFFF;
+		tempColor *= texture(u_TextureArray[arraySlot], vec3(Input.TextureCoord, layer));
+	}
+	else if (v_TextureIndex >= 0 && v_TextureIndex < 28)
+	{
+		tempColor *= texture(u_Texture[v_TextureIndex], Input.TextureCoord);
+	}
+
+	if (tempColor.a < 0.01)
+	{
+		discard;
+	}
+
+	// Final assignment
+	o_Color = tempColor;
+	o_EntityID = v_EntityID;
+}
@@ -3,6 +3,7 @@
 #include "Utils/EditorResourceManager.h"
 #include "NativeScripts.h"
 
+#include "Hazel/Scene/SceneBinarySerializer.h"
 #include "Hazel/Scene/SceneSerializer.h"
 #include "Hazel/Utils/PlatformUtils.h"
 #include "Hazel/Core/FileSystem.h"
@@ -20,6 +21,21 @@
 
 namespace Hazel
 {
+	static bool IsSceneFile(const std::filesystem::path& path)
+	{
+		return path.extension() == ".hazel" || path.extension() == ".hazelb";
+	}
+
+	static Scope<Serializer> CreateSceneSerializer(const Ref<Scene>& scene, const std::filesystem::path& path)
+	{
+		if (path.extension() == ".hazelb")
+		{
+			return CreateScope<SceneBinarySerializer>(scene);
+		}
+
+		return CreateScope<SceneSerializer>(scene);
+	}
+
 	EditorLayer::EditorLayer() : Layer("Hazel Editor") { }
 
 	void EditorLayer::OnAttach()
@@ -28,11 +44,14 @@ namespace Hazel
 
 		Utils::EditorResourceManager::Init();
 
-		// Set Fonts
+		// Set Fonts, there is no ImGui layer in headless builds.
 		auto* imGuiLayer = Application::Get().GetImGuiLayer();
-		const auto normalFontPath = "Resources/Fonts/opensans/OpenSans-SemiBold.ttf";
-		const auto boldFontPath = "Resources/Fonts/opensans/OpenSans-ExtraBold.ttf";
-		imGuiLayer->SetFonts(normalFontPath, {boldFontPath});
+		if (imGuiLayer)
+		{
+			const auto normalFontPath = "Resources/Fonts/opensans/OpenSans-SemiBold.ttf";
+			const auto boldFontPath = "Resources/Fonts/opensans/OpenSans-ExtraBold.ttf";
+			imGuiLayer->SetFonts(normalFontPath, {boldFontPath});
+		}
 
 		const auto framebufferSpecification = FramebufferSpecification
 		{
@@ -65,12 +84,16 @@ namespace Hazel
 		_editorCamera = EditorCamera(30.0f, 1.778f, 0.1f, 1000.0f);
 		Renderer2D::SetLineWidth(4.0f);
 
-		Application::Get().GetImGuiLayer()->BlockEvents(false);
+		if (imGuiLayer)
+		{
+			imGuiLayer->BlockEvents(false);
+		}
 	}
 
 	void EditorLayer::OnDetach()
 	{
 		HZ_PROFILE_FUNCTION();
+		WaitForSceneSave();
 		Utils::EditorResourceManager::Shutdown();
 	}
 
@@ -79,6 +102,11 @@ namespace Hazel
 		HZ_PROFILE_FUNCTION();
 		_updateTimer.Reset();
 
+		if (_sceneSaveTask.valid() && _sceneSaveTask.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+		{
+			WaitForSceneSave();
+		}
+
 		if (!_activeScene)
 		{
 			return;
@@ -358,6 +386,23 @@ namespace Hazel
 			}
 			break;
 		}
+		// Runtime Commands
+		case Key::F5: // Quick save
+		{
+			if (!isModiferPressed && _sceneState != SceneState::Edit)
+			{
+				_activeScene->SaveSnapshot("QuickSave");
+			}
+			break;
+		}
+		case Key::F9: // Quick load
+		{
+			if (!isModiferPressed && _sceneState != SceneState::Edit && _activeScene->RestoreSnapshot("QuickSave"))
+			{
+				_sceneHierarchyPanel.SetSelectedEntity(Entity());
+			}
+			break;
+		}
 		// TODO make this work
 		//case Key::Escape:
 		//{
@@ -541,7 +586,7 @@ namespace Hazel
 
 	void EditorLayer::OpenScene()
 	{
-		const auto filePath = FileDialogs::OpenFile("Hazel Scene (*.hazel)\0*.hazel\0");
+		const auto filePath = FileDialogs::OpenFile("Hazel Scene (*.hazel;*.hazelb)\0*.hazel;*.hazelb\0");
 		if (!filePath.empty())
 		{
 			OpenScene(filePath, true);
@@ -550,7 +595,7 @@ namespace Hazel
 
 	void EditorLayer::OpenScene(const std::filesystem::path& path, bool withCheck)
 	{
-		if (path.extension().string() != ".hazel")
+		if (!IsSceneFile(path))
 		{
 			HZ_CORE_LERROR("Could not load {0} - not a scene file.", path.filename().string());
 			return;
@@ -567,10 +612,12 @@ namespace Hazel
 			return;
 		}
 
+		WaitForSceneSave();
+
 		_editorScene = CreateRef<Scene>();
 		_editorScenePath.clear();
-		SceneSerializer serializer(_editorScene);
-		if (serializer.Deserialize(path.string(), withCheck))
+		const auto serializer = CreateSceneSerializer(_editorScene, path);
+		if (serializer->Deserialize(path.string(), withCheck))
 		{
 			_editorScenePath = path;
 
@@ -608,7 +655,7 @@ namespace Hazel
 		}
 
 		const auto sceneName = _activeScene->GetName();
-		const auto filePath = FileDialogs::SaveFile("Hazel Scene (*.hazel)\0*.hazel\0", !sceneName.empty() ? sceneName.c_str() : nullptr, defaultPath);
+		const auto filePath = FileDialogs::SaveFile("Hazel Scene (*.hazel)\0*.hazel\0Hazel Binary Scene (*.hazelb)\0*.hazelb\0", !sceneName.empty() ? sceneName.c_str() : nullptr, defaultPath);
 
 		if (!filePath.empty())
 		{
@@ -622,13 +669,41 @@ namespace Hazel
 		return false;
 	}
 
-	void EditorLayer::SerializeScene() const
+	void EditorLayer::SerializeScene()
 	{
-		SceneSerializer serializer(_activeScene);
-		serializer.Serialize(_editorScenePath.string());
+		WaitForSceneSave();
+
+		if (_editorScenePath.extension() == ".hazel")
+		{
+			// Written from a copy, big scenes don't block the editor.
+			_sceneSaveTask = SceneSerializer::SerializeAsync(_activeScene, _editorScenePath);
+			_sceneSavePath = _editorScenePath;
+			return;
+		}
+
+		const auto serializer = CreateSceneSerializer(_activeScene, _editorScenePath);
+		serializer->Serialize(_editorScenePath.string());
+
 		HZ_CORE_LINFO("[{0}] scene serialized.", _activeScene->GetName());
 	}
 
+	void EditorLayer::WaitForSceneSave()
+	{
+		if (!_sceneSaveTask.valid())
+		{
+			return;
+		}
+
+		if (_sceneSaveTask.get())
+		{
+			HZ_CORE_LINFO("[{0}] scene serialized.", _sceneSavePath.stem().string());
+		}
+		else
+		{
+			HZ_CORE_LERROR("[{0}] scene could not be written to {1}!", _sceneSavePath.stem().string(), _sceneSavePath.string());
+		}
+	}
+
 	void EditorLayer::NewProject()
 	{
 		if (!ClearSceneCheck())
@@ -1209,7 +1284,7 @@ namespace Hazel
 			{
 				const std::filesystem::path filePath = static_cast<const wchar_t*>(payload->Data);
 
-				if (filePath.extension() == ".hazel")
+				if (IsSceneFile(filePath))
 				{
 					OpenScene(filePath, true);
 				}
@@ -1217,7 +1292,7 @@ namespace Hazel
 				if (filePath.extension() == ".png")
 				{
 					auto newEntity = _activeScene->CreateEntity(filePath.filename().string());
-					newEntity.AddComponent<SpriteRendererComponent>().Texture = Texture2D::Create(filePath.string());
+					newEntity.AddComponent<SpriteRendererComponent>().TextureHandle = AssetManager::ImportTexture(filePath);
 					_sceneHierarchyPanel.SetSelectedEntity(newEntity);
 				}
 			}
@@ -1361,10 +1436,36 @@ namespace Hazel
 
 		ImGui::Separator();
 		ImGui::Text("Renderer 2D Stats:");
+		ImGui::Text("Mode: %s", Renderer2D::IsInstanced() ? "Instanced" : "Batched");
 		ImGui::Text("Draw Calls: %d", stats.DrawCalls);
 		ImGui::Text("Quad Count: %d", stats.QuadCount);
 		ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
 		ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+		ImGui::Text("Texture Slot Flushes: %d", stats.TextureSlotFlushes);
+		ImGui::Text("Font Atlas Flushes: %d", stats.FontAtlasFlushes);
+		ImGui::Text("Capacity Flushes: %d", stats.CapacityFlushes);
+		ImGui::Text("Order Flushes: %d", stats.OrderFlushes);
+		ImGui::Text("Static Quads: %d", stats.StaticQuadCount);
+		ImGui::Text("Texture Arrays: %d (%d textures)", stats.TextureArrayPages, stats.ResidentTextures);
+		bool textureArrays = Renderer2D::AreTextureArraysEnabled();
+		if (ImGui::Checkbox("Use Texture Arrays", &textureArrays))
+		{
+			Renderer2D::SetTextureArraysEnabled(textureArrays);
+		}
+
+		if (_activeScene)
+		{
+			const auto& renderStats = _activeScene->GetRenderStats();
+			ImGui::Text("Submitted Entities: %d", renderStats.SubmittedCount);
+			ImGui::Text("Culled Entities: %d", renderStats.CulledCount);
+			ImGui::Text("Static Entities: %d", renderStats.StaticCount);
+		}
+
+		const auto assetStats = AssetManager::GetStatistics();
+		ImGui::Separator();
+		ImGui::Text("Assets: %d (%d loaded, %d pending)", assetStats.AssetCount, assetStats.LoadedCount, assetStats.PendingCount);
+		ImGui::Text("Texture Memory: %.2f / %.2f MB", assetStats.MemoryUsage / (1024.0f * 1024.0f), assetStats.MemoryBudget / (1024.0f * 1024.0f));
+		ImGui::Text("Loads: %d, Evictions: %d", assetStats.LoadCount, assetStats.EvictionCount);
 
 		ImGui::Separator();
 		ImGui::Text("Viewport Update");
@@ -1388,6 +1489,42 @@ namespace Hazel
 			_imGuiTimerSlowestElapsedMillis = -FLT_MAX;
 		}
 
+		ImGui::Separator();
+		ImGui::Text("Scripting");
+		bool batchedScriptUpdates = ScriptEngine::AreBatchedUpdatesEnabled();
+		if (ImGui::Checkbox("Batch Script Updates", &batchedScriptUpdates))
+		{
+			ScriptEngine::SetBatchedUpdatesEnabled(batchedScriptUpdates);
+		}
+		ImGui::BeginDisabled(_sceneState != SceneState::Edit);
+		if (ImGui::Button("Benchmark Script Updates"))
+		{
+			_scriptUpdateBenchmark = ScriptEngine::RunUpdateBenchmark();
+		}
+		ImGui::EndDisabled();
+		if (_scriptUpdateBenchmark.InstanceCount > 0)
+		{
+			const float toNanosPerCall = 1000000.0f / _scriptUpdateBenchmark.InstanceCount;
+			ImGui::Text("Instances: %u", _scriptUpdateBenchmark.InstanceCount);
+			ImGui::Text("Runtime Invoke: %.3f ms (%.1f ns per call)", _scriptUpdateBenchmark.RuntimeInvokeMillis, _scriptUpdateBenchmark.RuntimeInvokeMillis * toNanosPerCall);
+			ImGui::Text("Thunk: %.3f ms (%.1f ns per call)", _scriptUpdateBenchmark.ThunkMillis, _scriptUpdateBenchmark.ThunkMillis * toNanosPerCall);
+			ImGui::Text("Dispatcher: %.3f ms (%.1f ns per script)", _scriptUpdateBenchmark.DispatcherMillis, _scriptUpdateBenchmark.DispatcherMillis * toNanosPerCall);
+		}
+
+		ImGui::BeginDisabled(_sceneState != SceneState::Edit);
+		if (ImGui::Button("Benchmark Script Fields"))
+		{
+			_scriptFieldBenchmark = ScriptEngine::RunFieldBenchmark();
+		}
+		ImGui::EndDisabled();
+		if (_scriptFieldBenchmark.InstanceCount > 0 && _scriptFieldBenchmark.FieldCount > 0)
+		{
+			const float toNanosPerField = 1000000.0f / (_scriptFieldBenchmark.InstanceCount * _scriptFieldBenchmark.FieldCount);
+			ImGui::Text("Instances: %u, Fields: %u", _scriptFieldBenchmark.InstanceCount, _scriptFieldBenchmark.FieldCount);
+			ImGui::Text("Lookup: %.3f ms (%.1f ns per field)", _scriptFieldBenchmark.LookupMillis, _scriptFieldBenchmark.LookupMillis * toNanosPerField);
+			ImGui::Text("Accessor: %.3f ms (%.1f ns per field)", _scriptFieldBenchmark.AccessorMillis, _scriptFieldBenchmark.AccessorMillis * toNanosPerField);
+		}
+
 		ImGui::Separator();
 		ImGui::Text("Active Id: %u", ImGui::GetActiveID());
 
@@ -1527,7 +1664,9 @@ namespace Hazel
 		_sceneState = SceneState::Play;
 		_sceneHierarchyPanel.SetSelectedEntity(Entity(), true);
 
+		Timer copyTimer;
 		_activeScene = Scene::Copy(_editorScene);
+		HZ_LINFO("Scene copied for play in {0}ms", copyTimer.ElapsedMillis());
 
 		_activeScene->OnRuntimeStart();
 
@@ -1538,7 +1677,9 @@ namespace Hazel
 	{
 		_sceneState = SceneState::Simulate;
 
+		Timer copyTimer;
 		_activeScene = Scene::Copy(_editorScene);
+		HZ_LINFO("Scene copied for simulation in {0}ms", copyTimer.ElapsedMillis());
 
 		_activeScene->OnSimulationStart();
 
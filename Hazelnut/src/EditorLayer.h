@@ -9,6 +9,9 @@
 #include "Hazel/Renderer/EditorCamera.h"
 
 #include "Hazel/Core/Timer.h"
+#include "Hazel/Scripting/ScriptEngine.h"
+
+#include <future>
 
 namespace Hazel
 {
@@ -40,7 +43,9 @@ namespace Hazel
 		void OpenScene(const std::filesystem::path& path, bool withCheck = false);
 		void SaveScene();
 		bool SaveSceneAs(const std::filesystem::path& defaultPath);
-		void SerializeScene() const;
+		void SerializeScene();
+		// Logs the result of the pending save, if any.
+		void WaitForSceneSave();
 
 		void NewProject();
 		void OpenProject();
@@ -81,6 +86,8 @@ namespace Hazel
 		Ref<Scene> _activeScene;
 		Ref<Scene> _editorScene;
 		std::filesystem::path _editorScenePath;
+		std::future<bool> _sceneSaveTask;
+		std::filesystem::path _sceneSavePath; // File written by _sceneSaveTask.
 
 		// FPS
 		int _frameCount = 0;
@@ -97,6 +104,9 @@ namespace Hazel
 		float _imGuiTimerFastestElapsedMillis = FLT_MAX;
 		float _imGuiTimerSlowestElapsedMillis = -FLT_MAX;
 
+		ScriptEngine::UpdateBenchmark _scriptUpdateBenchmark;
+		ScriptEngine::FieldBenchmark _scriptFieldBenchmark;
+
 		// Panels
 		SceneHierarchyPanel _sceneHierarchyPanel;
 		Scope<ContentBrowserPanel> _contentBrowserPanel;
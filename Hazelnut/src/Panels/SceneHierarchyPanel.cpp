@@ -24,10 +24,10 @@
 namespace Hazel
 {
 #define DrawScalarFieldInstance(Type, ImGuiType)						\
-			auto data = scriptInstance->GetFieldValue<Type>(name);		\
+			auto data = scriptInstance->GetFieldValue<Type>(field);		\
 			if (ImGui::DragScalar(name.c_str(), ImGuiType, &data, 0.1f))\
 			{															\
-				scriptInstance->SetFieldValue(name, data);				\
+				scriptInstance->SetFieldValue(field, data);				\
 			}
 #define DrawScalarField(Type, ImGuiType)								\
 			auto data = scriptField.GetValue<Type>();					\
@@ -47,10 +47,10 @@ namespace Hazel
 
 #define DrawVectorFieldInstance(Type)								\
 			const auto defaultValue = field.GetDefaultValue<Type>();\
-			auto data = scriptInstance->GetFieldValue<Type>(name);	\
+			auto data = scriptInstance->GetFieldValue<Type>(field);	\
 			if (DrawVecControls(name, data, defaultValue))			\
 			{														\
-				scriptInstance->SetFieldValue(name, data);			\
+				scriptInstance->SetFieldValue(field, data);			\
 			}
 
 #define DrawVectorField(Type)													\
@@ -567,6 +567,17 @@ namespace Hazel
 			component.Rotation = glm::radians(rotation);
 
 			DrawVecControls("Scale", component.Scale, glm::vec3(1.0f));
+
+			const char* mobilities[] = {"Dynamic", "Static"};
+			int mobility = static_cast<int>(component.Mobility);
+			const bool hasMobilityChanged = ImGui::Combo("Mobility", &mobility, mobilities, static_cast<int>(std::size(mobilities)));
+			component.Mobility = static_cast<TransformMobility>(mobility);
+
+			// Moved static transforms are noticed by the scene, a new mobility changes the hierarchy.
+			if (hasMobilityChanged)
+			{
+				_scene->InvalidateStaticGeometry();
+			}
 		});
 #pragma endregion
 
@@ -668,7 +679,7 @@ namespace Hazel
 			// If scene Running
 			if (_scene->IsRunning())
 			{
-				if (auto scriptInstance = ScriptEngine::GetEntityScriptInstance(entity.GetUUID()))
+				if (auto scriptInstance = ScriptEngine::GetEntityScriptInstance(entity))
 				{
 					const auto& fields = scriptInstance->GetScriptClass()->GetFields();
 					for (const auto& [name, field] : fields)
@@ -687,21 +698,21 @@ namespace Hazel
 						}
 						case ScriptFieldType::Char:
 						{
-							auto data = scriptInstance->GetFieldValue<uint16_t>(name);
+							auto data = scriptInstance->GetFieldValue<uint16_t>(field);
 							char buffer[2] = {static_cast<char>(data)};
 							if (ImGui::InputText(name.c_str(), buffer, sizeof(buffer)))
 							{
 								data = static_cast<uint16_t>(static_cast<uint8_t>(*buffer));
-								scriptInstance->SetFieldValue(name, data);
+								scriptInstance->SetFieldValue(field, data);
 							}
 							break;
 						}
 						case ScriptFieldType::Bool:
 						{
-							auto data = scriptInstance->GetFieldValue<bool>(name);
+							auto data = scriptInstance->GetFieldValue<bool>(field);
 							if (ImGui::Checkbox(name.c_str(), &data))
 							{
-								scriptInstance->SetFieldValue(name, data);
+								scriptInstance->SetFieldValue(field, data);
 							}
 							break;
 						}
@@ -762,16 +773,16 @@ namespace Hazel
 						}
 						case ScriptFieldType::Color:
 						{
-							auto data = scriptInstance->GetFieldValue<Color>(name);
+							auto data = scriptInstance->GetFieldValue<Color>(field);
 							if (ImGui::ColorEdit4(name.c_str(), data.GetValuePtr()))
 							{
-								scriptInstance->SetFieldValue(name, data);
+								scriptInstance->SetFieldValue(field, data);
 							}
 							break;
 						}
 						case ScriptFieldType::Entity:
 						{
-							auto data = scriptInstance->GetFieldEntityValue(name);
+							auto data = scriptInstance->GetFieldEntityValue(field);
 							const auto fieldTypeClass = field.GetFieldTypeClass();
 
 							const char* comboName = data ? data.Name().c_str() : "(Null)";
@@ -779,7 +790,7 @@ namespace Hazel
 							{
 								if (ImGui::Selectable("(Null)"))
 								{
-									scriptInstance->SetFieldEntityValue(name, Entity());
+									scriptInstance->SetFieldEntityValue(field, Entity());
 								}
 
 								const auto isBaseClass = ScriptEngine::IsBaseClass(fieldTypeClass);
@@ -804,7 +815,7 @@ namespace Hazel
 
 									if (isSelected)
 									{
-										scriptInstance->SetFieldEntityValue(name, entity);
+										scriptInstance->SetFieldEntityValue(field, entity);
 									}
 
 									if (data && data.GetUUID() == entity.GetUUID())
@@ -823,18 +834,18 @@ namespace Hazel
 
 							entityDropTarget(fieldTypeClass, [&](Entity entity)
 							{
-								scriptInstance->SetFieldEntityValue(name, entity);
+								scriptInstance->SetFieldEntityValue(field, entity);
 							});
 							break;
 						}
 						case ScriptFieldType::String:
 						{
 							char buffer[256] = {};
-							auto data = scriptInstance->GetFieldStringValue(name);
+							auto data = scriptInstance->GetFieldStringValue(field);
 							strcpy_s(buffer, sizeof(buffer), data.c_str());
 							if (ImGui::InputText(name.c_str(), buffer, sizeof(buffer)))
 							{
-								scriptInstance->SetFieldStringValue(name, buffer);
+								scriptInstance->SetFieldStringValue(field, buffer);
 							}
 							break;
 						}
@@ -1283,14 +1294,17 @@ namespace Hazel
 #pragma endregion
 
 #pragma region SpriteRendererComponent
-		DrawComponent<SpriteRendererComponent>(entity, "Sprite Renderer", [](SpriteRendererComponent& component)
+		DrawComponent<SpriteRendererComponent>(entity, "Sprite Renderer", [&](SpriteRendererComponent& component)
 		{
+			const SpriteRendererComponent previousComponent = component;
+
 			ImGui::Text("Sprite");
 			ImGui::SameLine();
 			bool isSpritePressed;
-			if (component.Texture != nullptr)
+			const auto texture = AssetManager::GetTexture(component.TextureHandle);
+			if (texture != nullptr)
 			{
-				isSpritePressed = ImGui::ImageButton(component.Texture->GetRawID(), ImVec2(50.0f, 50.0f), ImVec2(0.0f, 1.0f), ImVec2(1.0f, 0.0f), 3);
+				isSpritePressed = ImGui::ImageButton(texture->GetRawID(), ImVec2(50.0f, 50.0f), ImVec2(0.0f, 1.0f), ImVec2(1.0f, 0.0f), 3);
 			}
 			else
 			{
@@ -1319,11 +1333,11 @@ namespace Hazel
 				textureFilePath = FileDialogs::OpenFile("PNG (*.png)\0*.png\0");
 			}
 
-			if (component.Texture != nullptr)
+			if (texture != nullptr)
 			{
 				DrawYesNoPopup("Clear Texture?", [&]
 				{
-					component.Texture = nullptr;
+					component.TextureHandle = UUID::Invalid;
 				});
 			}
 
@@ -1331,17 +1345,7 @@ namespace Hazel
 			{
 				if (Utils::Path::IsSubpath(textureFilePath, Project::GetAssetDirectory()))
 				{
-					uint32_t magFilter = 0;
-					if (component.Texture)
-					{
-						magFilter = component.Texture->GetMagFilter();
-					}
-
-					component.Texture = Texture2D::Create(textureFilePath);
-					if (magFilter && component.Texture != nullptr)
-					{
-						component.Texture->SetMagFilter(magFilter);
-					}
+					component.TextureHandle = AssetManager::ImportTexture(textureFilePath);
 				}
 				else
 				{
@@ -1352,14 +1356,24 @@ namespace Hazel
 				}
 			}
 
-			if (component.Texture != nullptr)
+			if (component.TextureHandle != UUID::Invalid)
 			{
-				if (ImGui::Button("Mag Filter Toggle"))
+				// The filter belongs to the texture asset, every sprite using it is affected.
+				if (AssetManager::IsTextureLoaded(component.TextureHandle))
 				{
-					component.Texture->ToggleMagFilter(component.Texture->GetMagFilter());
+					const auto loadedTexture = AssetManager::GetTexture(component.TextureHandle);
+					if (ImGui::Button("Mag Filter Toggle"))
+					{
+						loadedTexture->ToggleMagFilter(loadedTexture->GetMagFilter());
+						AssetManager::SetTextureMagFilter(component.TextureHandle, loadedTexture->GetMagFilter());
+					}
+					ImGui::SameLine();
+					ImGui::Text("%s", loadedTexture->IsMagFilterLinear() ? "Linear" : "Nearest");
+				}
+				else
+				{
+					ImGui::Text("Loading...");
 				}
-				ImGui::SameLine();
-				ImGui::Text("%s", component.Texture->IsMagFilterLinear() ? "Linear" : "Nearest");
 				DrawVecControls("Tiling", component.Tiling, glm::vec2(1.0f));
 			}
 
@@ -1369,6 +1383,12 @@ namespace Hazel
 			{
 				color = newColor;
 			}
+
+			const bool hasChanged = component.TextureHandle != previousComponent.TextureHandle || !(component.Color == previousComponent.Color) || component.Tiling != previousComponent.Tiling;
+			if (_scene->IsRunning() && hasChanged)
+			{
+				_scene->InvalidateStaticSprite(entity);
+			}
 		});
 #pragma endregion
 
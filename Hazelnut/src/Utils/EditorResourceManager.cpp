@@ -1,5 +1,7 @@
 #include "EditorResourceManager.h"
 
+#include "Hazel/Core/Timer.h"
+
 namespace Hazel::Utils
 {
 	struct EditorResourceData
@@ -13,6 +15,9 @@ namespace Hazel::Utils
 	{
 		sEditorResourceData = new EditorResourceData();
 
+		// Decoded images come from the texture cache after the first launch.
+		Timer timer;
+
 		sEditorResourceData->Textures =
 		{
 			{ Icon_Pan,				Texture2D::Create("Resources/Icons/Gizmo/PanIcon256White.png")		 },
@@ -35,6 +40,8 @@ namespace Hazel::Utils
 			{ Icon_Folder,			Texture2D::Create("Resources/Icons/ContentBrowser/FolderIcon256.png")},
 			{ Icon_File,			Texture2D::Create("Resources/Icons/ContentBrowser/FileIcon256.png")	 },
 		};
+
+		HZ_CORE_LINFO("Loaded {0} editor images in {1}ms", sEditorResourceData->Textures.size(), timer.ElapsedMillis());
 	}
 
 	void EditorResourceManager::Shutdown()
@@ -242,13 +242,90 @@ void Sandbox2D::DrawStats()
 	ImGui::Begin("Stats", nullptr);
 
 	ImGui::Text("Renderer 2D Stats:");
+	ImGui::Text("Mode: %s", Hazel::Renderer2D::IsInstanced() ? "Instanced" : "Batched");
 	ImGui::Text("Draw Calls: %d", stats.DrawCalls);
 	ImGui::Text("Quad Count: %d", stats.QuadCount);
 	ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
 	ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+	ImGui::Text("Texture Slot Flushes: %d", stats.TextureSlotFlushes);
+	ImGui::Text("Font Atlas Flushes: %d", stats.FontAtlasFlushes);
+	ImGui::Text("Capacity Flushes: %d", stats.CapacityFlushes);
+	ImGui::Text("Order Flushes: %d", stats.OrderFlushes);
+	ImGui::Text("Static Quads: %d", stats.StaticQuadCount);
+	ImGui::Text("Texture Arrays: %d (%d textures)", stats.TextureArrayPages, stats.ResidentTextures);
+	bool textureArrays = Hazel::Renderer2D::AreTextureArraysEnabled();
+	if (ImGui::Checkbox("Use Texture Arrays", &textureArrays))
+	{
+		Hazel::Renderer2D::SetTextureArraysEnabled(textureArrays);
+	}
 	auto cycle = (glm::sin(Hazel::Platform::GetTime()) + 1.0f) * 0.5f;
 	ImGui::Text("Ms per frame: %d", _updateTimer.ElapsedMillis());
 
+	ImGui::Separator();
+	if (ImGui::Button("Benchmark Quad Kernels"))
+	{
+		_quadKernelBenchmark = Hazel::Renderer2D::BenchmarkQuadKernels();
+	}
+	if (_quadKernelBenchmark.QuadCount > 0)
+	{
+		ImGui::Text("Quads: %u", _quadKernelBenchmark.QuadCount);
+		ImGui::Text("Reference: %.3f ms", _quadKernelBenchmark.ReferenceMillis);
+		ImGui::Text("Scalar: %.3f ms", _quadKernelBenchmark.ScalarMillis);
+		ImGui::Text("SIMD: %.3f ms", _quadKernelBenchmark.SIMDMillis);
+	}
+
+	ImGui::Separator();
+	if (ImGui::Button("Benchmark Transform Hierarchies"))
+	{
+		_transformBenchmarks.clear();
+		for (const uint32_t depth : {1u, 4u, 16u, 64u})
+		{
+			_transformBenchmarks.push_back(Hazel::TransformHierarchy::RunBenchmark(100000, depth));
+		}
+	}
+	for (const auto& benchmark : _transformBenchmarks)
+	{
+		ImGui::Text("%u entities, depth %u", benchmark.EntityCount, benchmark.Depth);
+		ImGui::Text("Recursive: %.3f ms", benchmark.RecursiveMillis);
+		ImGui::Text("Packed: %.3f ms", benchmark.PackedMillis);
+		ImGui::Text("Packed Parallel: %.3f ms", benchmark.PackedParallelMillis);
+		ImGui::Text("Unchanged: %.3f ms", benchmark.UnchangedMillis);
+	}
+
+	ImGui::Separator();
+	if (ImGui::Button("Benchmark Scene Loading"))
+	{
+		_sceneLoadBenchmarks.clear();
+		for (const uint32_t entityCount : {10000u, 100000u})
+		{
+			_sceneLoadBenchmarks.push_back(Hazel::SceneSerializer::RunLoadBenchmark(entityCount));
+		}
+	}
+	for (const auto& benchmark : _sceneLoadBenchmarks)
+	{
+		ImGui::Text("%u entities", benchmark.EntityCount);
+		ImGui::Text("Create: %.3f ms", benchmark.CreateMillis);
+		ImGui::Text("Parse: %.3f ms", benchmark.ParseMillis);
+		ImGui::Text("Deserialize: %.3f ms", benchmark.DeserializeMillis);
+		ImGui::Text("Copy: %.3f ms", benchmark.CopyMillis);
+	}
+
+	ImGui::Separator();
+	if (ImGui::Button("Benchmark Scene Files"))
+	{
+		_sceneFileBenchmarks.clear();
+		for (const uint32_t entityCount : {10000u, 100000u})
+		{
+			_sceneFileBenchmarks.push_back(Hazel::SceneBinarySerializer::RunBenchmark(entityCount));
+		}
+	}
+	for (const auto& benchmark : _sceneFileBenchmarks)
+	{
+		ImGui::Text("%u entities", benchmark.EntityCount);
+		ImGui::Text("YAML: save %.3f ms, load %.3f ms, %llu bytes", benchmark.YamlSaveMillis, benchmark.YamlLoadMillis, benchmark.YamlFileSize);
+		ImGui::Text("Binary: save %.3f ms, load %.3f ms, %llu bytes", benchmark.BinarySaveMillis, benchmark.BinaryLoadMillis, benchmark.BinaryFileSize);
+	}
+
 	ImGui::End();
 }
 
@@ -1,6 +1,9 @@
 #pragma once
 #include "Hazel.h"
 #include "Hazel/Core/Timer.h"
+#include "Hazel/Scene/SceneBinarySerializer.h"
+#include "Hazel/Scene/SceneSerializer.h"
+#include "Hazel/Scene/TransformHierarchy.h"
 #include "ParticleSystem.h"
 
 class Sandbox2D final : public Hazel::Layer
@@ -53,4 +56,9 @@ private:
 	uint32_t _mapHeight;
 
 	std::unordered_map<char, Hazel::Ref<Hazel::SubTexture2D>> _textureMap;
+
+	Hazel::Renderer2D::QuadKernelBenchmark _quadKernelBenchmark;
+	std::vector<Hazel::TransformHierarchy::Benchmark> _transformBenchmarks;
+	std::vector<Hazel::SceneSerializer::LoadBenchmark> _sceneLoadBenchmarks;
+	std::vector<Hazel::SceneBinarySerializer::Benchmark> _sceneFileBenchmarks;
 };
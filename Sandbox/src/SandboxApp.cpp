@@ -31,5 +31,13 @@ Hazel::Application* Hazel::CreateApplication(ApplicationCommandLineArgs args)
 	spec.WorkingDirectory = "../Hazelnut";
 	spec.CommandLineArgs = args;
 
+	for (int i = 1; i < args.Count; i++)
+	{
+		if (std::string_view(args[i]) == "--instanced")
+		{
+			spec.InstancedRenderer2D = true;
+		}
+	}
+
 	return new Sandbox(spec);
 }
@@ -1,6 +1,12 @@
 include "./vendor/premake/premake_customization/solution_items.lua"
 include "Dependencies.lua"
 
+newoption
+{
+	trigger = "headless",
+	description = "Use the Null RendererAPI so the engine can run without a GPU (CI, benchmarks)"
+}
+
 workspace "Hazel"
 	architecture "x86_64"
 	startproject "Hazelnut"
@@ -26,6 +32,11 @@ workspace "Hazel"
 	{
 		"MSDFGEN_USE_LODEPNG"
 	}
+
+	filter "options:headless"
+		defines "HZ_HEADLESS"
+
+	filter {}
 	
 outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 